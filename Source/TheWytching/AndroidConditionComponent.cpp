@@ -1,10 +1,12 @@
 #include "AndroidConditionComponent.h"
 #include "AndroidTypes.h"
+#include "WytchPowerSubsystem.h"
+#include "WytchConditionRules.h"
 #include "TimerManager.h"
 
 UAndroidConditionComponent::UAndroidConditionComponent()
 {
-	PrimaryComponentTick.bCanEverTick = false; // power drain uses timer, not tick
+	PrimaryComponentTick.bCanEverTick = false; // power drain is batched in UWytchPowerSubsystem
 }
 
 void UAndroidConditionComponent::BeginPlay()
@@ -19,17 +21,12 @@ void UAndroidConditionComponent::BeginPlay()
 
 	// Initialize active capabilities from base
 	ActiveCapabilities = BaseCapabilities;
+	ActiveCapabilityMask = FWytchCapabilityRegistry::Get().MakeWorkerMask(ActiveCapabilities);
 
-	// Start power drain timer
-	if (UWorld* World = GetWorld())
+	// Power drain is batched — hand our power state to the power system
+	if (UWytchPowerSubsystem* Power = UWytchPowerSubsystem::Get(GetWorld()))
 	{
-		World->GetTimerManager().SetTimer(
-			PowerDrainTimerHandle,
-			this,
-			&UAndroidConditionComponent::DrainPower,
-			PowerDrainInterval,
-			true // looping
-		);
+		Power->RegisterCondition(this);
 	}
 
 	UE_LOG(LogWytchAndroid, Log, TEXT("%s: ConditionComponent initialized — Power=%.2f, Capabilities=%s, Seed=%u"),
@@ -39,49 +36,111 @@ void UAndroidConditionComponent::BeginPlay()
 		PersonalitySeed);
 }
 
-void UAndroidConditionComponent::DrainPower()
+void UAndroidConditionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (PowerState == EAndroidPowerState::Dead)
+	// A batch still pending has no one left to hear it
+	bConditionDirty = false;
+	PendingSubsystemStatuses.Reset();
+
+	if (UWytchPowerSubsystem* Power = UWytchPowerSubsystem::Get(GetWorld()))
 	{
-		return;
+		Power->UnregisterCondition(this);
 	}
 
-	PowerLevel = FMath::Clamp(PowerLevel - (PowerDrainRate * PowerDrainInterval), 0.0f, 1.0f);
+	Super::EndPlay(EndPlayReason);
+}
+
+// ─────────────────────────────────────────────────────────
+// Power — state lives in UWytchPowerSubsystem while registered
+// ─────────────────────────────────────────────────────────
+
+float UAndroidConditionComponent::GetPowerLevel() const
+{
+	if (const UWytchPowerSubsystem* Power = UWytchPowerSubsystem::Get(GetWorld()))
+	{
+		float Level = 0.0f;
+		if (Power->TryGetPowerLevel(this, Level))
+		{
+			return Level;
+		}
+	}
+	return PowerLevel;
+}
+
+void UAndroidConditionComponent::SetPowerLevel(float NewLevel)
+{
+	PowerLevel = FMath::Clamp(NewLevel, 0.0f, 1.0f);
+	if (UWytchPowerSubsystem* Power = UWytchPowerSubsystem::Get(GetWorld()))
+	{
+		Power->SetPowerLevel(this, PowerLevel);
+	}
 	UpdatePowerState();
 }
 
-void UAndroidConditionComponent::UpdatePowerState()
+void UAndroidConditionComponent::SetPowerDrainRate(float NewRate)
 {
-	EAndroidPowerState OldState = PowerState;
-	EAndroidPowerState NewState;
+	PowerDrainRate = FMath::Max(NewRate, 0.0f);
+	if (UWytchPowerSubsystem* Power = UWytchPowerSubsystem::Get(GetWorld()))
+	{
+		Power->SetDrainRate(this, PowerDrainRate);
+	}
+}
+
+void UAndroidConditionComponent::ApplyPowerLevel(float Level)
+{
+	PowerLevel = Level;
+	UpdatePowerState();
+}
 
-	if (PowerLevel <= 0.0f)
+EAndroidPowerState UAndroidConditionComponent::GetPowerStateForLevel(float Level)
+{
+	if (Level <= 0.0f)
 	{
-		NewState = EAndroidPowerState::Dead;
+		return EAndroidPowerState::Dead;
 	}
-	else if (PowerLevel <= 0.1f)
+	if (Level <= CriticalPowerThreshold)
 	{
-		NewState = EAndroidPowerState::Critical;
+		return EAndroidPowerState::Critical;
 	}
-	else if (PowerLevel <= 0.3f)
+	if (Level <= LowPowerThreshold)
 	{
-		NewState = EAndroidPowerState::Low;
+		return EAndroidPowerState::Low;
 	}
-	else
+	return EAndroidPowerState::Normal;
+}
+
+float UAndroidConditionComponent::GetNextPowerThreshold(EAndroidPowerState State)
+{
+	switch (State)
 	{
-		NewState = EAndroidPowerState::Normal;
+	case EAndroidPowerState::Normal:	return LowPowerThreshold;
+	case EAndroidPowerState::Low:		return CriticalPowerThreshold;
+	case EAndroidPowerState::Critical:	return 0.0f;
+	default:							return -1.0f;
 	}
+}
+
+void UAndroidConditionComponent::UpdatePowerState()
+{
+	EAndroidPowerState OldState = PowerState;
+	EAndroidPowerState NewState = GetPowerStateForLevel(PowerLevel);
 
 	if (NewState != OldState)
 	{
+		MarkConditionDirty();
 		PowerState = NewState;
 		OnPowerStateChanged.Broadcast(OldState, NewState);
 
 		UE_LOG(LogWytchAndroid, Log, TEXT("%s: Power state changed %s → %s (level=%.2f)"),
-			*GetOwner()->GetName(),
+			*GetNameSafe(GetOwner()),
 			*UEnum::GetValueAsString(OldState),
 			*UEnum::GetValueAsString(NewState),
 			PowerLevel);
+
+		if (!bCoalesceConditionChanges)
+		{
+			FlushConditionChanges();
+		}
 	}
 }
 
@@ -95,15 +154,20 @@ void UAndroidConditionComponent::SetSubsystemStatus(ESubsystemType System, ESubs
 		return;
 	}
 
+	MarkConditionDirty();
+	PendingSubsystemStatuses.FindOrAdd(FName(StaticEnum<ESubsystemType>()->GetNameStringByValue((int64)System)), OldStatus);
 	StatusRef = NewStatus;
-	OnSubsystemChanged.Broadcast(System, OldStatus, NewStatus);
-	RecalculateCapabilities();
 
 	UE_LOG(LogWytchAndroid, Log, TEXT("%s: Subsystem %s changed %s → %s"),
-		*GetOwner()->GetName(),
+		*GetNameSafe(GetOwner()),
 		*UEnum::GetValueAsString(System),
 		*UEnum::GetValueAsString(OldStatus),
 		*UEnum::GetValueAsString(NewStatus));
+
+	if (!bCoalesceConditionChanges)
+	{
+		FlushConditionChanges();
+	}
 }
 
 ESubsystemStatus UAndroidConditionComponent::GetSubsystemStatus(ESubsystemType System) const
@@ -126,83 +190,234 @@ ESubsystemStatus& UAndroidConditionComponent::GetSubsystemStatusRef(ESubsystemTy
 	}
 }
 
-void UAndroidConditionComponent::RecalculateCapabilities()
+void UAndroidConditionComponent::SetSubsystemStatusByName(FName System, ESubsystemStatus NewStatus)
 {
-	// Start from base capabilities
-	FGameplayTagContainer NewCapabilities = BaseCapabilities;
+	const int32 Bit = FWytchConditionRuleTable::Get().GetSubsystemBit(System);
+	if (Bit == INDEX_NONE)
+	{
+		UE_LOG(LogWytchAndroid, Warning, TEXT("%s: Unknown subsystem '%s' — add it to ConditionRules ExtraSubsystems"),
+			*GetNameSafe(GetOwner()), *System.ToString());
+		return;
+	}
 
-	// Remove capabilities that depend on destroyed subsystems.
-	// Degraded subsystems keep capabilities but may affect quality (handled by StateTree).
-	// Destroyed subsystems lose associated capabilities entirely.
+	if (Bit < FWytchConditionRuleTable::NumBuiltInSubsystems)
+	{
+		SetSubsystemStatus(static_cast<ESubsystemType>(Bit), NewStatus);
+		return;
+	}
 
-	// Manipulators destroyed → lose Building, Hauling
-	if (ManipulatorLeft == ESubsystemStatus::Destroyed && ManipulatorRight == ESubsystemStatus::Destroyed)
+	const ESubsystemStatus OldStatus = GetSubsystemStatusByName(System);
+	if (OldStatus == NewStatus)
 	{
-		NewCapabilities.RemoveTag(FGameplayTag::RequestGameplayTag(FName("Capability.Building")));
-		NewCapabilities.RemoveTag(FGameplayTag::RequestGameplayTag(FName("Capability.Hauling")));
+		return;
 	}
 
-	// Locomotion destroyed → lose everything requiring movement
-	if (LocomotionStatus == ESubsystemStatus::Destroyed)
+	MarkConditionDirty();
+	PendingSubsystemStatuses.FindOrAdd(System, OldStatus);
+	if (NewStatus == ESubsystemStatus::Operational)
 	{
-		NewCapabilities.RemoveTag(FGameplayTag::RequestGameplayTag(FName("Capability.Hauling")));
-		NewCapabilities.RemoveTag(FGameplayTag::RequestGameplayTag(FName("Capability.Patrol")));
+		ExtraSubsystems.Remove(System);
 	}
+	else
+	{
+		ExtraSubsystems.Add(System, NewStatus);
+	}
+
+	UE_LOG(LogWytchAndroid, Log, TEXT("%s: Subsystem %s changed %s → %s"),
+		*GetNameSafe(GetOwner()),
+		*System.ToString(),
+		*UEnum::GetValueAsString(OldStatus),
+		*UEnum::GetValueAsString(NewStatus));
 
-	// Vision destroyed → lose LaserCutter (needs targeting), Combat
-	if (VisionStatus == ESubsystemStatus::Destroyed)
+	if (!bCoalesceConditionChanges)
 	{
-		NewCapabilities.RemoveTag(FGameplayTag::RequestGameplayTag(FName("Capability.LaserCutter")));
-		NewCapabilities.RemoveTag(FGameplayTag::RequestGameplayTag(FName("Capability.Combat")));
+		FlushConditionChanges();
 	}
+}
 
-	if (NewCapabilities != ActiveCapabilities)
+// ─────────────────────────────────────────────────────────
+// Change batching — one recalculation and one diff per frame
+// ─────────────────────────────────────────────────────────
+
+void UAndroidConditionComponent::MarkConditionDirty()
+{
+	if (bConditionDirty)
 	{
-		ActiveCapabilities = NewCapabilities;
+		return;
+	}
 
-		UE_LOG(LogWytchAndroid, Log, TEXT("%s: Capabilities recalculated → %s"),
-			*GetOwner()->GetName(),
-			*ActiveCapabilities.ToStringSimple());
+	// Snapshot what the diff is measured against
+	bConditionDirty = true;
+	PendingPowerState = PowerState;
+	PendingCapabilities = ActiveCapabilities;
+
+	if (bCoalesceConditionChanges)
+	{
+		if (UWorld* World = GetWorld())
+		{
+			World->GetTimerManager().SetTimerForNextTick(this, &UAndroidConditionComponent::FlushConditionChanges);
+		}
 	}
 }
 
-EAndroidReadiness UAndroidConditionComponent::GetReadiness() const
+void UAndroidConditionComponent::FlushConditionChanges()
 {
-	// Dead = disabled
-	if (PowerState == EAndroidPowerState::Dead)
+	if (!bConditionDirty)
+	{
+		return;
+	}
+	bConditionDirty = false;
+
+	FWytchConditionDiff Diff;
+	Diff.OldPowerState = PendingPowerState;
+	Diff.NewPowerState = PowerState;
+
+	// Net change per subsystem — a hit that was repaired within the batch drops out
+	TMap<FName, ESubsystemStatus> Pending = MoveTemp(PendingSubsystemStatuses);
+	PendingSubsystemStatuses.Reset();
+	for (const TPair<FName, ESubsystemStatus>& Entry : Pending)
+	{
+		const ESubsystemStatus NewStatus = GetSubsystemStatusByName(Entry.Key);
+		if (NewStatus != Entry.Value)
+		{
+			Diff.SubsystemChanges.Add({ Entry.Key, Entry.Value, NewStatus });
+		}
+	}
+
+	if (!Diff.SubsystemChanges.IsEmpty())
+	{
+		RecalculateCapabilities();
+	}
+
+	for (const FGameplayTag& Tag : ActiveCapabilities)
 	{
-		return EAndroidReadiness::Disabled;
+		if (!PendingCapabilities.HasTagExact(Tag))
+		{
+			Diff.AddedCapabilities.AddTagFast(Tag);
+		}
 	}
+	for (const FGameplayTag& Tag : PendingCapabilities)
+	{
+		if (!ActiveCapabilities.HasTagExact(Tag))
+		{
+			Diff.RemovedCapabilities.AddTagFast(Tag);
+		}
+	}
+	PendingCapabilities.Reset();
 
-	// Any destroyed subsystem or critical power = needs maintenance
-	if (PowerState == EAndroidPowerState::Critical ||
-		VisionStatus == ESubsystemStatus::Destroyed ||
-		AudioStatus == ESubsystemStatus::Destroyed ||
-		LocomotionStatus == ESubsystemStatus::Destroyed ||
-		ManipulatorLeft == ESubsystemStatus::Destroyed ||
-		ManipulatorRight == ESubsystemStatus::Destroyed ||
-		CommLink == ESubsystemStatus::Destroyed)
+	if (Diff.IsEmpty())
 	{
-		return EAndroidReadiness::NeedsMaintenance;
+		return;
 	}
 
-	// Any degraded subsystem or low power = degraded
-	if (PowerState == EAndroidPowerState::Low ||
-		VisionStatus == ESubsystemStatus::Degraded ||
-		AudioStatus == ESubsystemStatus::Degraded ||
-		LocomotionStatus == ESubsystemStatus::Degraded ||
-		ManipulatorLeft == ESubsystemStatus::Degraded ||
-		ManipulatorRight == ESubsystemStatus::Degraded ||
-		CommLink == ESubsystemStatus::Degraded)
+	// Per-subsystem events keep firing for existing listeners, once per net change
+	const int32 NumBuiltIn = FWytchConditionRuleTable::NumBuiltInSubsystems;
+	for (const FWytchSubsystemChange& Change : Diff.SubsystemChanges)
 	{
-		return EAndroidReadiness::Degraded;
+		const int32 Bit = FWytchConditionRuleTable::Get().GetSubsystemBit(Change.System);
+		if (Bit != INDEX_NONE && Bit < NumBuiltIn)
+		{
+			OnSubsystemChanged.Broadcast(static_cast<ESubsystemType>(Bit), Change.OldStatus, Change.NewStatus);
+		}
 	}
 
-	// Locomotion immobile = disabled regardless of other subsystems
-	if (LocomotionStatus == ESubsystemStatus::Destroyed)
+	OnConditionChanged.Broadcast(Diff);
+}
+
+ESubsystemStatus UAndroidConditionComponent::GetSubsystemStatusByName(FName System) const
+{
+	const int32 Bit = FWytchConditionRuleTable::Get().GetSubsystemBit(System);
+	if (Bit != INDEX_NONE && Bit < FWytchConditionRuleTable::NumBuiltInSubsystems)
+	{
+		return GetSubsystemStatus(static_cast<ESubsystemType>(Bit));
+	}
+
+	const ESubsystemStatus* Status = ExtraSubsystems.Find(System);
+	return Status ? *Status : ESubsystemStatus::Operational;
+}
+
+void UAndroidConditionComponent::GetSubsystemBits(uint32& OutDegradedBits, uint32& OutDestroyedBits) const
+{
+	OutDegradedBits = 0;
+	OutDestroyedBits = 0;
+
+	auto Accumulate = [&OutDegradedBits, &OutDestroyedBits](int32 Bit, ESubsystemStatus Status)
+	{
+		if (Bit == INDEX_NONE || Status == ESubsystemStatus::Operational) return;
+
+		OutDegradedBits |= uint32(1) << Bit;
+		if (Status == ESubsystemStatus::Destroyed)
+		{
+			OutDestroyedBits |= uint32(1) << Bit;
+		}
+	};
+
+	Accumulate(FWytchConditionRuleTable::GetSubsystemBit(ESubsystemType::Vision), VisionStatus);
+	Accumulate(FWytchConditionRuleTable::GetSubsystemBit(ESubsystemType::Audio), AudioStatus);
+	Accumulate(FWytchConditionRuleTable::GetSubsystemBit(ESubsystemType::Locomotion), LocomotionStatus);
+	Accumulate(FWytchConditionRuleTable::GetSubsystemBit(ESubsystemType::ManipulatorLeft), ManipulatorLeft);
+	Accumulate(FWytchConditionRuleTable::GetSubsystemBit(ESubsystemType::ManipulatorRight), ManipulatorRight);
+	Accumulate(FWytchConditionRuleTable::GetSubsystemBit(ESubsystemType::CommLink), CommLink);
+
+	if (!ExtraSubsystems.IsEmpty())
+	{
+		const FWytchConditionRuleTable& Table = FWytchConditionRuleTable::Get();
+		for (const TPair<FName, ESubsystemStatus>& Extra : ExtraSubsystems)
+		{
+			Accumulate(Table.GetSubsystemBit(Extra.Key), Extra.Value);
+		}
+	}
+}
+
+void UAndroidConditionComponent::RecalculateCapabilities()
+{
+	// Which destroyed/degraded subsystems strip which capabilities is data — see UWytchConditionRules
+	uint32 DegradedBits = 0;
+	uint32 DestroyedBits = 0;
+	GetSubsystemBits(DegradedBits, DestroyedBits);
+	const FWytchConditionEffects Effects = FWytchConditionRuleTable::Get().Evaluate(DegradedBits, DestroyedBits);
+
+	// Start from base capabilities, drop every tag that is — or, for Task.* tags, maps to — a removed
+	// capability. Matching is hierarchical: removing Capability.Hauling also drops Capability.Hauling.Heavy.
+	FGameplayTagContainer NewCapabilities;
+	const FWytchCapabilityRegistry& Registry = FWytchCapabilityRegistry::Get();
+	for (const FGameplayTag& Tag : BaseCapabilities)
+	{
+		if (Effects.RemovedCapabilities.IsEmpty() ||
+			!Registry.ToCapabilities(FGameplayTagContainer(Tag)).HasAny(Effects.RemovedCapabilities))
+		{
+			NewCapabilities.AddTagFast(Tag);
+		}
+	}
+
+	if (NewCapabilities != ActiveCapabilities)
+	{
+		ActiveCapabilities = NewCapabilities;
+		ActiveCapabilityMask = FWytchCapabilityRegistry::Get().MakeWorkerMask(ActiveCapabilities);
+
+		UE_LOG(LogWytchAndroid, Log, TEXT("%s: Capabilities recalculated → %s"),
+			*GetOwner()->GetName(),
+			*ActiveCapabilities.ToStringSimple());
+
+		OnCapabilitiesChanged.Broadcast();
+	}
+}
+
+EAndroidReadiness UAndroidConditionComponent::GetReadiness() const
+{
+	// Power brackets map straight onto readiness
+	EAndroidReadiness Readiness = EAndroidReadiness::FullyOperational;
+	switch (PowerState)
 	{
-		return EAndroidReadiness::Disabled;
+	case EAndroidPowerState::Dead:		return EAndroidReadiness::Disabled;
+	case EAndroidPowerState::Critical:	Readiness = EAndroidReadiness::NeedsMaintenance; break;
+	case EAndroidPowerState::Low:		Readiness = EAndroidReadiness::Degraded; break;
+	default:							break;
 	}
 
-	return EAndroidReadiness::FullyOperational;
+	// Subsystem damage → readiness floors come from the rule table
+	uint32 DegradedBits = 0;
+	uint32 DestroyedBits = 0;
+	GetSubsystemBits(DegradedBits, DestroyedBits);
+	return FMath::Max(Readiness, FWytchConditionRuleTable::Get().Evaluate(DegradedBits, DestroyedBits).Readiness);
 }
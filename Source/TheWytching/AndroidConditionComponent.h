@@ -4,6 +4,7 @@
 #include "Components/ActorComponent.h"
 #include "GameplayTagContainer.h"
 #include "AndroidTypes.h"
+#include "WytchCapabilityMask.h"
 #include "AndroidConditionComponent.generated.h"
 
 /**
@@ -11,7 +12,8 @@
  * subsystem health, and derived capability state. Foundation of the
  * autonomy + degradation system.
  *
- * Tick runs on a 1-2 second timer for power drain.
+ * Power drain is batched across every android by UWytchPowerSubsystem —
+ * no per-component timer or tick.
  * RecalculateCapabilities() fires only on subsystem change events.
  */
 UCLASS(ClassGroup=(Wytcherly), meta=(BlueprintSpawnableComponent))
@@ -24,12 +26,17 @@ public:
 
 	// ── Power ──
 
-	/** Current power level, 0.0 = dead, 1.0 = full. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Android|Power", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	/**
+	 * Current power level, 0.0 = dead, 1.0 = full. While registered with the
+	 * power system this field is the starting value; read through GetPowerLevel().
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintGetter = GetPowerLevel, BlueprintSetter = SetPowerLevel,
+		Category = "Android|Power", meta = (ClampMin = "0.0", ClampMax = "1.0"))
 	float PowerLevel = 1.0f;
 
-	/** Power drain per second. Varies by activity — set externally by StateTree tasks. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Android|Power", meta = (ClampMin = "0.0"))
+	/** Power drain per second. Varies by activity — set externally by StateTree tasks via SetPowerDrainRate. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetPowerDrainRate,
+		Category = "Android|Power", meta = (ClampMin = "0.0"))
 	float PowerDrainRate = 0.001f;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Android|Power")
@@ -61,6 +68,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Android|Subsystems")
 	ESubsystemStatus CommLink = ESubsystemStatus::Operational;
 
+	/** Designer subsystems (UWytchConditionRules::ExtraSubsystems) by name. Absent = Operational. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Android|Subsystems")
+	TMap<FName, ESubsystemStatus> ExtraSubsystems;
+
 	// ── Capabilities ──
 
 	/** Base capabilities set at fabrication. Does not change at runtime. */
@@ -71,6 +82,9 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Android|Capabilities")
 	FGameplayTagContainer ActiveCapabilities;
 
+	/** ActiveCapabilities as a bitmask — kept in step by RecalculateCapabilities. */
+	const FWytchCapabilityMask& GetActiveCapabilityMask() const { return ActiveCapabilityMask; }
+
 	// ── Personality ──
 
 	/** Random seed assigned at fabrication. Biases autonomous behavior choices. */
@@ -94,9 +108,33 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Android|Events")
 	FOnPowerStateChanged OnPowerStateChanged;
 
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnCapabilitiesChanged);
+
+	/** Fires when RecalculateCapabilities changes ActiveCapabilities. */
+	UPROPERTY(BlueprintAssignable, Category = "Android|Events")
+	FOnCapabilitiesChanged OnCapabilitiesChanged;
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnConditionChanged, const FWytchConditionDiff&, Diff);
+
+	/**
+	 * One event per batch of condition changes — subsystem statuses, power
+	 * bracket and capabilities, as a net diff. Prefer this over the
+	 * per-field events for work that should run once per android per frame.
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Android|Events")
+	FOnConditionChanged OnConditionChanged;
+
+	/**
+	 * Batch every condition change made during a frame: subsystem changes
+	 * recalculate capabilities once and OnSubsystemChanged / OnConditionChanged
+	 * fire on the next tick. Off = recalculate and broadcast on each change.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Android|Events")
+	bool bCoalesceConditionChanges = true;
+
 	// ── Interface ──
 
-	/** Recalculates ActiveCapabilities based on current subsystem health. */
+	/** Recalculates ActiveCapabilities from subsystem health through the UWytchConditionRules table. */
 	UFUNCTION(BlueprintCallable, Category = "Android|Condition")
 	void RecalculateCapabilities();
 
@@ -104,7 +142,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Android|Condition")
 	EAndroidReadiness GetReadiness() const;
 
-	/** Sets a subsystem's status and fires OnSubsystemChanged + RecalculateCapabilities. */
+	/** Sets a subsystem's status; OnSubsystemChanged + RecalculateCapabilities follow per bCoalesceConditionChanges. */
 	UFUNCTION(BlueprintCallable, Category = "Android|Condition")
 	void SetSubsystemStatus(ESubsystemType System, ESubsystemStatus NewStatus);
 
@@ -112,22 +150,63 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Android|Condition")
 	ESubsystemStatus GetSubsystemStatus(ESubsystemType System) const;
 
+	/** SetSubsystemStatus for any rule-table subsystem — ESubsystemType names route to the built-in fields. */
+	UFUNCTION(BlueprintCallable, Category = "Android|Condition")
+	void SetSubsystemStatusByName(FName System, ESubsystemStatus NewStatus);
+
+	UFUNCTION(BlueprintCallable, Category = "Android|Condition")
+	ESubsystemStatus GetSubsystemStatusByName(FName System) const;
+
+	/** Live power level — from UWytchPowerSubsystem while registered. */
+	UFUNCTION(BlueprintGetter)
+	float GetPowerLevel() const;
+
+	/** Sets power (clamped 0..1), updates PowerState and broadcasts on a bracket change. */
+	UFUNCTION(BlueprintSetter)
+	void SetPowerLevel(float NewLevel);
+
+	UFUNCTION(BlueprintSetter)
+	void SetPowerDrainRate(float NewRate);
+
+	/** At or below these levels the android is Low / Critical; at 0 it is Dead. */
+	static constexpr float LowPowerThreshold = 0.3f;
+	static constexpr float CriticalPowerThreshold = 0.1f;
+
+	/** Power bracket for a level — the Low/Critical/Dead thresholds every power path shares. */
+	static EAndroidPowerState GetPowerStateForLevel(float Level);
+
+	/** Level at which a draining android leaves State. Negative for Dead. */
+	static float GetNextPowerThreshold(EAndroidPowerState State);
+
+	/** Power system write-back for androids whose level crossed a threshold. */
+	void ApplyPowerLevel(float Level);
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
-	/** Timer-driven power drain. */
-	void DrainPower();
-
 	/** Updates PowerState from PowerLevel and broadcasts if changed. */
 	void UpdatePowerState();
 
 	/** Returns a reference to the subsystem status field for a given type. */
 	ESubsystemStatus& GetSubsystemStatusRef(ESubsystemType System);
 
-	FTimerHandle PowerDrainTimerHandle;
+	/** Rule-table bits of every subsystem at Degraded-or-worse and at Destroyed. */
+	void GetSubsystemBits(uint32& OutDegradedBits, uint32& OutDestroyedBits) const;
+
+	/** Call before changing condition state — snapshots the diff baseline and schedules the flush. */
+	void MarkConditionDirty();
+
+	/** Recalculates once and broadcasts the batch's net diff. */
+	void FlushConditionChanges();
+
+	bool bConditionDirty = false;
+
+	/** Status of each subsystem changed this batch, as it was before the first change. */
+	TMap<FName, ESubsystemStatus> PendingSubsystemStatuses;
+	EAndroidPowerState PendingPowerState = EAndroidPowerState::Normal;
+	FGameplayTagContainer PendingCapabilities;
 
-	/** How often power drain ticks (seconds). */
-	UPROPERTY(EditAnywhere, Category = "Android|Power", meta = (ClampMin = "0.5", ClampMax = "5.0"))
-	float PowerDrainInterval = 1.5f;
+	FWytchCapabilityMask ActiveCapabilityMask;
 };
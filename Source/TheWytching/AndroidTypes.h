@@ -94,3 +94,49 @@ enum class EWorkEndReason : uint8
 	Aborted		UMETA(DisplayName = "Aborted"),
 	Failed		UMETA(DisplayName = "Failed")
 };
+
+// ─────────────────────────────────────────────────────────
+// FWytchSubsystemChange / FWytchConditionDiff — net condition
+// change of one android since its last OnConditionChanged
+// ─────────────────────────────────────────────────────────
+USTRUCT(BlueprintType)
+struct FWytchSubsystemChange
+{
+	GENERATED_BODY()
+
+	/** ESubsystemType name or a UWytchConditionRules extra subsystem. */
+	UPROPERTY(BlueprintReadOnly, Category = "Android|Condition")
+	FName System;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Android|Condition")
+	ESubsystemStatus OldStatus = ESubsystemStatus::Operational;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Android|Condition")
+	ESubsystemStatus NewStatus = ESubsystemStatus::Operational;
+};
+
+USTRUCT(BlueprintType)
+struct FWytchConditionDiff
+{
+	GENERATED_BODY()
+
+	/** Subsystems whose status differs from the start of the batch — changes that reverted are absent. */
+	UPROPERTY(BlueprintReadOnly, Category = "Android|Condition")
+	TArray<FWytchSubsystemChange> SubsystemChanges;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Android|Condition")
+	EAndroidPowerState OldPowerState = EAndroidPowerState::Normal;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Android|Condition")
+	EAndroidPowerState NewPowerState = EAndroidPowerState::Normal;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Android|Condition")
+	FGameplayTagContainer AddedCapabilities;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Android|Condition")
+	FGameplayTagContainer RemovedCapabilities;
+
+	bool HasPowerStateChanged() const { return OldPowerState != NewPowerState; }
+	bool HasCapabilitiesChanged() const { return !AddedCapabilities.IsEmpty() || !RemovedCapabilities.IsEmpty(); }
+	bool IsEmpty() const { return SubsystemChanges.IsEmpty() && !HasPowerStateChanged() && !HasCapabilitiesChanged(); }
+};
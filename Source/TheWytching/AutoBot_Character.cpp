@@ -3,13 +3,20 @@
 #include "AndroidConditionComponent.h"
 #include "IWytchWorkSite.h"
 #include "Foreman_AIController.h"
+#include "ForemanRegistrySubsystem.h"
+#include "WytchMoveWatchdogSubsystem.h"
+#include "WytchSignificanceSubsystem.h"
+#include "WytchWorkSessionSubsystem.h"
 #include "SmartObjectSubsystem.h"
 #include "SmartObjectRuntime.h"
 #include "SmartObjectRequestTypes.h"
 #include "AIController.h"
+#include "Perception/AIPerceptionComponent.h"
+#include "Perception/AISenseConfig.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "TimerManager.h"
 #include "StructView.h"
-#include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 
 // ─────────────────────────────────────────────────────────
@@ -21,6 +28,12 @@ AAutoBot_Character::AAutoBot_Character()
 	PrimaryActorTick.bCanEverTick = false; // state driven by timers/callbacks — no per-frame tick needed
 
 	ConditionComponent = CreateDefaultSubobject<UAndroidConditionComponent>(TEXT("AndroidCondition"));
+
+	// URO skips anim updates by screen size on top of the significance tier's tick interval
+	if (USkeletalMeshComponent* MeshComp = GetMesh())
+	{
+		MeshComp->bEnableUpdateRateOptimizations = true;
+	}
 }
 
 // ─────────────────────────────────────────────────────────
@@ -32,17 +45,32 @@ void AAutoBot_Character::BeginPlay()
 	Super::BeginPlay();
 	// NOTE: Super::BeginPlay() fires all component BeginPlay callbacks,
 	// including UAndroidConditionComponent::BeginPlay which sets
-	// ActiveCapabilities = BaseCapabilities and starts the power drain timer.
+	// ActiveCapabilities = BaseCapabilities and registers with
+	// UWytchPowerSubsystem, which drains power for every android.
 	// We append SpecialistCapabilities AFTER Super so we layer on top of that.
 
 	if (ConditionComponent)
 	{
 		ConditionComponent->BaseCapabilities.AppendTags(SpecialistCapabilities);
 		ConditionComponent->RecalculateCapabilities();
+
+		// Readiness and capabilities feed GetWorkerState/GetCapabilities — forward
+		// their changes to the Foreman roster via WorkerStateChanged
+		ConditionComponent->OnConditionChanged.AddDynamic(this, &AAutoBot_Character::HandleConditionChanged);
 	}
 
+	ReportedWorkerState = GetWorkerState_Implementation();
 	RegisterWithForeman();
 
+	if (const USkeletalMeshComponent* MeshComp = GetMesh())
+	{
+		DefaultAnimTickOption = MeshComp->VisibilityBasedAnimTickOption;
+	}
+	if (UWytchSignificanceSubsystem* Significance = UWytchSignificanceSubsystem::Get(GetWorld()))
+	{
+		Significance->RegisterWorker(this);
+	}
+
 	UE_LOG(LogWytchWorker, Log,
 		TEXT("AutoBot [%s] class=%d ready — capabilities: %s"),
 		*GetName(),
@@ -52,39 +80,139 @@ void AAutoBot_Character::BeginPlay()
 
 // ─────────────────────────────────────────────────────────
 // RegisterWithForeman
-// Finds the first AForeman_AIController in the world and registers self.
-// Safe to call at BeginPlay — Foreman controller is expected to exist.
-// If the Foreman isn't ready yet, BP_FOREMAN_V2's BeginPlay can call
-// RegisterWorker(Self) as a fallback.
+// Hands self to the Foreman registry, which picks the Foreman owning the
+// zone we stand in (or the nearest). If no Foreman is up yet the registry
+// holds us and assigns us once one registers.
 // ─────────────────────────────────────────────────────────
 
 void AAutoBot_Character::RegisterWithForeman()
 {
-	UWorld* World = GetWorld();
-	if (!World) return;
-
-	// Foreman_AIController lives on the Foreman pawn — find it via world
-	TArray<AActor*> Controllers;
-	UGameplayStatics::GetAllActorsOfClass(World, AForeman_AIController::StaticClass(), Controllers);
-
-	if (Controllers.IsEmpty())
+	UForemanRegistrySubsystem* Registry = UForemanRegistrySubsystem::Get(GetWorld());
+	if (!Registry)
 	{
 		UE_LOG(LogWytchWorker, Warning,
-			TEXT("AutoBot [%s] RegisterWithForeman: no AForeman_AIController found — will not be in roster"),
+			TEXT("AutoBot [%s] RegisterWithForeman: no Foreman registry — will not be in roster"),
 			*GetName());
 		return;
 	}
 
-	// Use the first Foreman found (single-Foreman assumption — revisit for multi-Foreman)
-	if (AForeman_AIController* ForemanAIC = Cast<AForeman_AIController>(Controllers[0]))
+	Registry->AssignWorker(this);
+
+	if (const AForeman_AIController* ForemanAIC = Registry->GetOwningForeman(this))
 	{
-		ForemanAIC->RegisterWorker(this);
 		UE_LOG(LogWytchWorker, Log,
 			TEXT("AutoBot [%s] registered with Foreman [%s]"),
 			*GetName(), *ForemanAIC->GetName());
 	}
 }
 
+void AAutoBot_Character::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UForemanRegistrySubsystem* Registry = UForemanRegistrySubsystem::Get(GetWorld()))
+	{
+		Registry->RemoveWorker(this);
+	}
+
+	if (UWytchSignificanceSubsystem* Significance = UWytchSignificanceSubsystem::Get(GetWorld()))
+	{
+		Significance->UnregisterWorker(this);
+	}
+
+	StopMoveTracking();
+	StopWorkSession();
+	if (AAIController* AIC = Cast<AAIController>(GetController()))
+	{
+		AIC->ReceiveMoveCompleted.RemoveDynamic(this, &AAutoBot_Character::HandleMoveCompleted);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AAutoBot_Character::PossessedBy(AController* NewController)
+{
+	Super::PossessedBy(NewController);
+
+	// Controller-side LOD (AI tick, perception) needs re-applying to a new controller
+	if (const UWytchSignificanceSubsystem* Significance = UWytchSignificanceSubsystem::Get(GetWorld()))
+	{
+		ApplySignificanceTier(SignificanceTier, Significance->GetTierSettings(SignificanceTier));
+	}
+}
+
+// ─────────────────────────────────────────────────────────
+// Significance LOD — settings pushed on tier change only
+// ─────────────────────────────────────────────────────────
+
+void AAutoBot_Character::ApplySignificanceTier(EWytchSignificanceTier Tier, const FWytchSignificanceTierSettings& Settings)
+{
+	SignificanceTier = Tier;
+
+	if (UCharacterMovementComponent* Movement = GetCharacterMovement())
+	{
+		Movement->SetComponentTickInterval(Settings.MovementTickInterval);
+	}
+
+	if (USkeletalMeshComponent* MeshComp = GetMesh())
+	{
+		MeshComp->SetComponentTickInterval(Settings.AnimTickInterval);
+		MeshComp->VisibilityBasedAnimTickOption = Settings.bOnlyTickMontagesWhenNotRendered
+			? EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered
+			: DefaultAnimTickOption;
+	}
+
+	if (AAIController* AIC = Cast<AAIController>(GetController()))
+	{
+		AIC->SetActorTickInterval(Settings.AITickInterval);
+
+		if (UAIPerceptionComponent* Perception = AIC->GetAIPerceptionComponent())
+		{
+			for (auto It = Perception->GetSensesConfigIterator(); It; ++It)
+			{
+				if (const UAISenseConfig* SenseConfig = *It)
+				{
+					Perception->SetSenseEnabled(SenseConfig->GetSenseImplementation(), Settings.bPerceptionEnabled);
+				}
+			}
+		}
+	}
+}
+
+// ─────────────────────────────────────────────────────────
+// Worker state — every change goes through SetWorkerState
+// ─────────────────────────────────────────────────────────
+
+void AAutoBot_Character::SetWorkerState(EWorkerState NewState)
+{
+	WorkerState = NewState;
+	BroadcastWorkerStateIfChanged();
+}
+
+void AAutoBot_Character::BroadcastWorkerStateIfChanged()
+{
+	const EWorkerState EffectiveState = GetWorkerState_Implementation();
+	if (EffectiveState == ReportedWorkerState)
+	{
+		return;
+	}
+
+	const EWorkerState OldState = ReportedWorkerState;
+	ReportedWorkerState = EffectiveState;
+	WorkerStateChanged.Broadcast(this, OldState, EffectiveState);
+}
+
+void AAutoBot_Character::HandleConditionChanged(const FWytchConditionDiff& Diff)
+{
+	// Dead power → Unavailable without touching WorkerState
+	const EWorkerState OldReported = ReportedWorkerState;
+	BroadcastWorkerStateIfChanged();
+
+	// Capability change alone still needs the roster to re-read us — once per batch
+	if (Diff.HasCapabilitiesChanged() && ReportedWorkerState == OldReported)
+	{
+		WorkerStateChanged.Broadcast(this, ReportedWorkerState, ReportedWorkerState);
+	}
+}
+
 void AAutoBot_Character::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -115,8 +243,10 @@ void AAutoBot_Character::ReceiveSmartObjectAssignment_Implementation(
 		return;
 	}
 
+	// Usually invalid — we claim on arrival. A valid handle is a claim taken for us
+	// before we existed (Mass entity promoted mid-task); adopt it.
 	PendingSlotHandle = SlotHandle;
-	ActiveClaimHandle = FSmartObjectClaimHandle::InvalidHandle;
+	ActiveClaimHandle = ClaimHandle;
 	TargetWorkActor = TargetActor;
 
 	UE_LOG(LogWytchWorker, Log,
@@ -126,6 +256,28 @@ void AAutoBot_Character::ReceiveSmartObjectAssignment_Implementation(
 	BeginNavigationToSlot();
 }
 
+// ─────────────────────────────────────────────────────────
+// IWytchCommandable — QueueFollowUpAssignment
+// Foreman reserves our next slot while we finish this one; CompleteWork
+// heads straight for it, so there is no Idle gap between jobs.
+// ─────────────────────────────────────────────────────────
+
+bool AAutoBot_Character::QueueFollowUpAssignment_Implementation(
+	FSmartObjectSlotHandle SlotHandle,
+	AActor* TargetActor)
+{
+	if (!SlotHandle.IsValid() || WorkerState != EWorkerState::Working || FollowUpSlotHandle.IsValid())
+	{
+		return false;
+	}
+
+	FollowUpSlotHandle = SlotHandle;
+	FollowUpWorkActor = TargetActor;
+
+	UE_LOG(LogWytchWorker, Log, TEXT("AutoBot [%s] follow-up queued"), *GetName());
+	return true;
+}
+
 // ─────────────────────────────────────────────────────────
 // IWytchCommandable — GetWorkerState
 // ─────────────────────────────────────────────────────────
@@ -163,13 +315,21 @@ void AAutoBot_Character::AbortCurrentTask_Implementation(EAbortReason Reason)
 		TEXT("AutoBot [%s] AbortCurrentTask reason=%d state=%d"),
 		*GetName(), (int32)Reason, (int32)WorkerState);
 
-	GetWorldTimerManager().ClearTimer(ArrivalCheckTimerHandle);
+	// Forget the move first — StopMovement reports it as Aborted synchronously
+	StopMoveTracking();
+	StopWorkSession();
 
 	if (AAIController* AIC = Cast<AAIController>(GetController()))
 	{
 		AIC->StopMovement();
 	}
 
+	if (WorkerState == EWorkerState::Working && IsValid(TargetWorkActor) &&
+		TargetWorkActor->Implements<UWytchWorkSite>())
+	{
+		IWytchWorkSite::Execute_EndWork(TargetWorkActor.Get(), this, EWorkEndReason::Aborted);
+	}
+
 	if (ActiveClaimHandle.IsValid())
 	{
 		if (USmartObjectSubsystem* SOSub = USmartObjectSubsystem::GetCurrent(GetWorld()))
@@ -181,7 +341,9 @@ void AAutoBot_Character::AbortCurrentTask_Implementation(EAbortReason Reason)
 	ActiveClaimHandle = FSmartObjectClaimHandle::InvalidHandle;
 	PendingSlotHandle = FSmartObjectSlotHandle();
 	TargetWorkActor = nullptr;
-	WorkerState = EWorkerState::Idle;
+	FollowUpSlotHandle = FSmartObjectSlotHandle();
+	FollowUpWorkActor = nullptr;
+	SetWorkerState(EWorkerState::Idle);
 }
 
 // ─────────────────────────────────────────────────────────
@@ -196,7 +358,7 @@ void AAutoBot_Character::BeginNavigationToSlot()
 		UE_LOG(LogWytchWorker, Warning,
 			TEXT("AutoBot [%s] BeginNavigationToSlot: no SmartObjectSubsystem"),
 			*GetName());
-		WorkerState = EWorkerState::Idle;
+		ReleaseAndReturnToIdle();
 		return;
 	}
 
@@ -206,48 +368,116 @@ void AAutoBot_Character::BeginNavigationToSlot()
 		UE_LOG(LogWytchWorker, Warning,
 			TEXT("AutoBot [%s] BeginNavigationToSlot: no slot transform"),
 			*GetName());
-		WorkerState = EWorkerState::Idle;
+		ReleaseAndReturnToIdle();
 		return;
 	}
 
 	SlotDestination = SlotTransform.GetValue().GetLocation();
-	WorkerState = EWorkerState::MovingToTask;
+	StopMoveTracking();
+	SetWorkerState(EWorkerState::MovingToTask);
 
-	if (AAIController* AIC = Cast<AAIController>(GetController()))
+	UE_LOG(LogWytchWorker, Log,
+		TEXT("AutoBot [%s] moving to (%.0f, %.0f, %.0f)"),
+		*GetName(), SlotDestination.X, SlotDestination.Y, SlotDestination.Z);
+
+	// Watchdog covers a missing controller, a move that ends short, or getting wedged
+	if (UWytchMoveWatchdogSubsystem* Watchdog = UWytchMoveWatchdogSubsystem::Get(GetWorld()))
 	{
-		AIC->MoveToLocation(SlotDestination, ArrivalAcceptanceRadius,
-			/*bStopOnOverlap=*/true,
-			/*bUsePathfinding=*/true,
-			/*bProjectDestinationToNavigation=*/true);
+		Watchdog->Watch(this, SlotDestination, ArrivalAcceptanceRadius * 1.5f,
+			FOnWytchMoveWatchdogEvent::CreateUObject(this, &AAutoBot_Character::HandleMoveWatchdogEvent));
 	}
 
-	GetWorldTimerManager().SetTimer(
-		ArrivalCheckTimerHandle,
-		this,
-		&AAutoBot_Character::OnArrivedAtSlot,
-		ArrivalCheckInterval,
-		/*bLoop=*/true);
+	AAIController* AIC = Cast<AAIController>(GetController());
+	if (!AIC) return;
 
-	UE_LOG(LogWytchWorker, Log,
-		TEXT("AutoBot [%s] moving to (%.0f, %.0f, %.0f)"),
-		*GetName(), SlotDestination.X, SlotDestination.Y, SlotDestination.Z);
+	AIC->ReceiveMoveCompleted.AddUniqueDynamic(this, &AAutoBot_Character::HandleMoveCompleted);
+
+	FAIMoveRequest MoveRequest(SlotDestination);
+	MoveRequest.SetAcceptanceRadius(ArrivalAcceptanceRadius);
+	MoveRequest.SetReachTestIncludesAgentRadius(true);
+	MoveRequest.SetUsePathfinding(true);
+	MoveRequest.SetProjectGoalLocation(true);
+
+	const FPathFollowingRequestResult MoveResult = AIC->MoveTo(MoveRequest);
+	switch (MoveResult.Code)
+	{
+	case EPathFollowingRequestResult::RequestSuccessful:
+		ActiveMoveRequestId = MoveResult.MoveId;
+		break;
+	case EPathFollowingRequestResult::AlreadyAtGoal:
+		OnArrivedAtSlot();
+		break;
+	default:
+		UE_LOG(LogWytchWorker, Warning,
+			TEXT("AutoBot [%s] BeginNavigationToSlot: no path to slot — returning to Idle"),
+			*GetName());
+		ReleaseAndReturnToIdle();
+		break;
+	}
 }
 
 // ─────────────────────────────────────────────────────────
-// OnArrivedAtSlot — timer-driven arrival check
+// Move completion — path-following callback, watchdog fallback
 // ─────────────────────────────────────────────────────────
 
-void AAutoBot_Character::OnArrivedAtSlot()
+void AAutoBot_Character::HandleMoveCompleted(FAIRequestID RequestID, EPathFollowingResult::Type Result)
 {
 	if (WorkerState != EWorkerState::MovingToTask) return;
+	if (!ActiveMoveRequestId.IsValid() || !ActiveMoveRequestId.IsEquivalent(RequestID)) return;
+
+	ActiveMoveRequestId = FAIRequestID::InvalidRequest;
 
-	if (FVector::DistSquared(GetActorLocation(), SlotDestination) >
-		FMath::Square(ArrivalAcceptanceRadius * 1.5f))
+	if (Result == EPathFollowingResult::Success ||
+		FVector::DistSquared(GetActorLocation(), SlotDestination) <= FMath::Square(ArrivalAcceptanceRadius * 1.5f))
 	{
-		return; // not there yet
+		OnArrivedAtSlot();
+		return;
 	}
 
-	GetWorldTimerManager().ClearTimer(ArrivalCheckTimerHandle);
+	UE_LOG(LogWytchWorker, Warning,
+		TEXT("AutoBot [%s] move ended short of slot (result=%d) — returning to Idle"),
+		*GetName(), (int32)Result);
+	ReleaseAndReturnToIdle();
+}
+
+void AAutoBot_Character::HandleMoveWatchdogEvent(EWytchMoveWatchdogEvent Event)
+{
+	if (WorkerState != EWorkerState::MovingToTask) return;
+
+	// Finish with the path request first — its completion callback must not race the watchdog's verdict
+	if (AAIController* AIC = Cast<AAIController>(GetController()))
+	{
+		ActiveMoveRequestId = FAIRequestID::InvalidRequest;
+		AIC->StopMovement();
+	}
+
+	if (Event == EWytchMoveWatchdogEvent::Arrived)
+	{
+		OnArrivedAtSlot();
+		return;
+	}
+	ReleaseAndReturnToIdle();
+}
+
+void AAutoBot_Character::StopMoveTracking()
+{
+	ActiveMoveRequestId = FAIRequestID::InvalidRequest;
+
+	if (UWytchMoveWatchdogSubsystem* Watchdog = UWytchMoveWatchdogSubsystem::Get(GetWorld()))
+	{
+		Watchdog->Unwatch(this);
+	}
+}
+
+// ─────────────────────────────────────────────────────────
+// OnArrivedAtSlot — claim and start work
+// ─────────────────────────────────────────────────────────
+
+void AAutoBot_Character::OnArrivedAtSlot()
+{
+	if (WorkerState != EWorkerState::MovingToTask) return;
+
+	StopMoveTracking();
 
 	USmartObjectSubsystem* SOSub = USmartObjectSubsystem::GetCurrent(GetWorld());
 	if (!SOSub)
@@ -258,10 +488,13 @@ void AAutoBot_Character::OnArrivedAtSlot()
 
 	// Claim the slot on arrival — worker holds claim (DEC-004)
 	// UE 5.7 API: MarkSlotAsClaimed(SlotHandle, ClaimPriority, UserData)
-	ActiveClaimHandle = SOSub->MarkSlotAsClaimed(
-		PendingSlotHandle,
-		ESmartObjectClaimPriority::Normal,
-		FConstStructView());
+	if (!ActiveClaimHandle.IsValid())
+	{
+		ActiveClaimHandle = SOSub->MarkSlotAsClaimed(
+			PendingSlotHandle,
+			ESmartObjectClaimPriority::Normal,
+			FConstStructView());
+	}
 	if (!ActiveClaimHandle.IsValid())
 	{
 		UE_LOG(LogWytchWorker, Warning,
@@ -271,16 +504,85 @@ void AAutoBot_Character::OnArrivedAtSlot()
 		return;
 	}
 
-	WorkerState = EWorkerState::Working;
+	SetWorkerState(EWorkerState::Working);
 	UE_LOG(LogWytchWorker, Log, TEXT("AutoBot [%s] claimed slot — Working"), *GetName());
 
-	if (IsValid(TargetWorkActor))
+	if (!IsValid(TargetWorkActor) || !TargetWorkActor->Implements<UWytchWorkSite>())
+	{
+		return; // No work site — hold the slot until the Foreman aborts
+	}
+
+	if (!IWytchWorkSite::Execute_BeginWork(TargetWorkActor.Get(), this))
+	{
+		UE_LOG(LogWytchWorker, Warning,
+			TEXT("AutoBot [%s] OnArrivedAtSlot: %s refused BeginWork — returning to Idle"),
+			*GetName(), *TargetWorkActor->GetName());
+		ReleaseAndReturnToIdle();
+		return;
+	}
+
+	// Work runs for the site's interaction duration; 0 = instant.
+	// The session manager advances progress and drives TickWork for every site in one pass.
+	const float Duration = IWytchWorkSite::Execute_GetInteractionDuration(TargetWorkActor.Get());
+	UWytchWorkSessionSubsystem* Sessions = UWytchWorkSessionSubsystem::Get(GetWorld());
+	if (Duration > 0.f && Sessions)
+	{
+		Sessions->BeginSession(this, TargetWorkActor.Get(), Duration,
+			FOnWytchWorkSessionComplete::CreateUObject(this, &AAutoBot_Character::CompleteWork));
+	}
+	else
+	{
+		CompleteWork();
+	}
+}
+
+void AAutoBot_Character::StopWorkSession()
+{
+	if (UWytchWorkSessionSubsystem* Sessions = UWytchWorkSessionSubsystem::Get(GetWorld()))
+	{
+		Sessions->EndSession(this);
+	}
+}
+
+// ─────────────────────────────────────────────────────────
+// CompleteWork — chain into the follow-up if the Foreman queued one
+// ─────────────────────────────────────────────────────────
+
+void AAutoBot_Character::CompleteWork()
+{
+	if (WorkerState != EWorkerState::Working) return;
+
+	StopWorkSession();
+
+	if (IsValid(TargetWorkActor) && TargetWorkActor->Implements<UWytchWorkSite>())
+	{
+		IWytchWorkSite::Execute_EndWork(TargetWorkActor.Get(), this, EWorkEndReason::Completed);
+	}
+
+	if (!FollowUpSlotHandle.IsValid())
+	{
+		ReleaseAndReturnToIdle();
+		return;
+	}
+
+	if (ActiveClaimHandle.IsValid())
 	{
-		if (IWytchWorkSite* WorkSite = Cast<IWytchWorkSite>(TargetWorkActor.Get()))
+		if (USmartObjectSubsystem* SOSub = USmartObjectSubsystem::GetCurrent(GetWorld()))
 		{
-			WorkSite->Execute_BeginWork(TargetWorkActor.Get(), this);
+			SOSub->MarkSlotAsFree(ActiveClaimHandle);
 		}
+		ActiveClaimHandle = FSmartObjectClaimHandle::InvalidHandle;
 	}
+
+	PendingSlotHandle = FollowUpSlotHandle;
+	TargetWorkActor = FollowUpWorkActor;
+	FollowUpSlotHandle = FSmartObjectSlotHandle();
+	FollowUpWorkActor = nullptr;
+
+	UE_LOG(LogWytchWorker, Log, TEXT("AutoBot [%s] work complete — chaining into follow-up"), *GetName());
+
+	// Working → MovingToTask: the Foreman reads this as complete + follow-up started
+	BeginNavigationToSlot();
 }
 
 // ─────────────────────────────────────────────────────────
@@ -289,7 +591,8 @@ void AAutoBot_Character::OnArrivedAtSlot()
 
 void AAutoBot_Character::ReleaseAndReturnToIdle()
 {
-	GetWorldTimerManager().ClearTimer(ArrivalCheckTimerHandle);
+	StopMoveTracking();
+	StopWorkSession();
 
 	if (ActiveClaimHandle.IsValid())
 	{
@@ -302,7 +605,9 @@ void AAutoBot_Character::ReleaseAndReturnToIdle()
 
 	PendingSlotHandle = FSmartObjectSlotHandle();
 	TargetWorkActor = nullptr;
-	WorkerState = EWorkerState::Idle;
+	FollowUpSlotHandle = FSmartObjectSlotHandle();
+	FollowUpWorkActor = nullptr;
+	SetWorkerState(EWorkerState::Idle);
 
 	UE_LOG(LogWytchWorker, Log, TEXT("AutoBot [%s] → Idle"), *GetName());
 }
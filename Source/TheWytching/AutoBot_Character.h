@@ -5,9 +5,14 @@
 #include "IWytchCommandable.h"
 #include "AndroidTypes.h"
 #include "SmartObjectRuntime.h"
+#include "AITypes.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "WytchSignificanceSubsystem.h"
 #include "AutoBot_Character.generated.h"
 
 class UAndroidConditionComponent;
+enum class EWytchMoveWatchdogEvent : uint8;
 
 // ─────────────────────────────────────────────────────────
 // EAutoBot_Class — three physical tiers (DEC-006)
@@ -51,7 +56,9 @@ public:
 	AAutoBot_Character();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
+	virtual void PossessedBy(AController* NewController) override;
 
 	// ── IWytchCommandable ─────────────────────────────────
 	// BlueprintNativeEvent — BPs may override; C++ _Implementation is the default.
@@ -61,12 +68,18 @@ public:
 		FSmartObjectSlotHandle SlotHandle,
 		AActor* TargetActor) override;
 
+	virtual bool QueueFollowUpAssignment_Implementation(
+		FSmartObjectSlotHandle SlotHandle,
+		AActor* TargetActor) override;
+
 	virtual EWorkerState GetWorkerState_Implementation() const override;
 
 	virtual FGameplayTagContainer GetCapabilities_Implementation() const override;
 
 	virtual void AbortCurrentTask_Implementation(EAbortReason Reason) override;
 
+	virtual FOnWytchWorkerStateChanged* GetWorkerStateChangedDelegate() override { return &WorkerStateChanged; }
+
 	// ── Accessors ─────────────────────────────────────────
 
 	UFUNCTION(BlueprintCallable, Category = "AutoBot|State")
@@ -78,6 +91,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "AutoBot|State")
 	bool HasActiveAssignment() const { return PendingSlotHandle.IsValid(); }
 
+	UFUNCTION(BlueprintCallable, Category = "AutoBot|State")
+	bool HasFollowUpAssignment() const { return FollowUpSlotHandle.IsValid(); }
+
+	UFUNCTION(BlueprintCallable, Category = "AutoBot|Significance")
+	EWytchSignificanceTier GetSignificanceTier() const { return SignificanceTier; }
+
+	/** Pushes an LOD tier to movement, animation and AI. Called by UWytchSignificanceSubsystem. */
+	void ApplySignificanceTier(EWytchSignificanceTier Tier, const FWytchSignificanceTierSettings& Settings);
+
 	// ── Designer vars (DEC-005 — BP-editable, logic in C++) ──
 
 	/**
@@ -102,11 +124,6 @@ public:
 		meta = (ClampMin = "10.0", ClampMax = "300.0"))
 	float ArrivalAcceptanceRadius = 80.f;
 
-	/** Arrival check poll rate (seconds). Lower = more responsive, higher = cheaper. */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AutoBot|Movement",
-		meta = (ClampMin = "0.05", ClampMax = "1.0"))
-	float ArrivalCheckInterval = 0.25f;
-
 protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AutoBot|Condition")
 	TObjectPtr<UAndroidConditionComponent> ConditionComponent;
@@ -123,12 +140,55 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AutoBot|State")
 	TObjectPtr<AActor> TargetWorkActor = nullptr;
 
+	/** Next task reserved by the Foreman while this one finishes — started on EndWork. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AutoBot|State")
+	FSmartObjectSlotHandle FollowUpSlotHandle;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AutoBot|State")
+	TObjectPtr<AActor> FollowUpWorkActor = nullptr;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AutoBot|Significance")
+	EWytchSignificanceTier SignificanceTier = EWytchSignificanceTier::High;
+
 private:
+	/** Single write path for WorkerState — broadcasts the effective state change. */
+	void SetWorkerState(EWorkerState NewState);
+
+	/** Broadcasts if GetWorkerState() no longer matches what was last reported. */
+	void BroadcastWorkerStateIfChanged();
+
+	/** One batched condition change — power bracket and/or capabilities — becomes at most one roster update. */
+	UFUNCTION()
+	void HandleConditionChanged(const FWytchConditionDiff& Diff);
+
 	void BeginNavigationToSlot();
 	void OnArrivedAtSlot();
+
+	/** AI controller move finished — arrival, or give up the task if it ended short. */
+	UFUNCTION()
+	void HandleMoveCompleted(FAIRequestID RequestID, EPathFollowingResult::Type Result);
+
+	/** Watchdog fallback — arrival the move never reported, or stuck en route. */
+	void HandleMoveWatchdogEvent(EWytchMoveWatchdogEvent Event);
+
+	/** Forgets the in-flight move so its completion callback is ignored. */
+	void StopMoveTracking();
+
+	/** Work session complete — EndWork(Completed), then the follow-up or Idle. */
+	void CompleteWork();
+
+	/** Drops our UWytchWorkSessionSubsystem session, if any. */
+	void StopWorkSession();
+
 	void ReleaseAndReturnToIdle();
 	void RegisterWithForeman();
 
-	FTimerHandle ArrivalCheckTimerHandle;
+	FAIRequestID ActiveMoveRequestId;
+
+	/** Mesh anim tick option from BP defaults — restored by tiers that tick off screen. */
+	EVisibilityBasedAnimTickOption DefaultAnimTickOption = EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
 	FVector SlotDestination = FVector::ZeroVector;
+
+	FOnWytchWorkerStateChanged WorkerStateChanged;
+	EWorkerState ReportedWorkerState = EWorkerState::Idle;
 };
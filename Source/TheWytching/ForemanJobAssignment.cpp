@@ -0,0 +1,206 @@
+#include "ForemanJobAssignment.h"
+
+#include "HAL/PlatformTime.h"
+
+namespace ForemanAssignment
+{
+	void SolveOptimal(const FCostMatrix& Matrix, TArray<int32>& OutSlotForWorker)
+	{
+		OutSlotForWorker.Init(INDEX_NONE, Matrix.NumWorkers);
+		if (Matrix.NumWorkers == 0 || Matrix.NumSlots == 0)
+		{
+			return;
+		}
+
+		// The row-by-row Hungarian variant needs Rows <= Cols — transpose when
+		// there are more workers than slots.
+		const bool bTransposed = Matrix.NumWorkers > Matrix.NumSlots;
+		const int32 Rows = bTransposed ? Matrix.NumSlots : Matrix.NumWorkers;
+		const int32 Cols = bTransposed ? Matrix.NumWorkers : Matrix.NumSlots;
+
+		auto RawCost = [&Matrix, bTransposed](int32 Row, int32 Col)
+		{
+			return bTransposed ? Matrix.Get(Col, Row) : Matrix.Get(Row, Col);
+		};
+
+		// Infeasible pairs get a penalty larger than any complete feasible
+		// assignment, so the solver only uses them when nothing else fits.
+		double MaxFeasible = 0.0;
+		for (const float Cost : Matrix.Costs)
+		{
+			if (Cost < Infeasible)
+			{
+				MaxFeasible = FMath::Max(MaxFeasible, (double)Cost);
+			}
+		}
+		const double Penalty = (MaxFeasible + 1.0) * (Rows + 1);
+
+		auto Cost = [&RawCost, Penalty](int32 Row, int32 Col)
+		{
+			const float C = RawCost(Row, Col);
+			return C < Infeasible ? (double)C : Penalty;
+		};
+
+		// Potentials and matching are 1-based; index 0 is the virtual column.
+		TArray<double> U, V, MinV;
+		TArray<int32> RowForCol, Way;
+		TArray<bool> Used;
+		U.Init(0.0, Rows + 1);
+		V.Init(0.0, Cols + 1);
+		RowForCol.Init(0, Cols + 1);
+		Way.Init(0, Cols + 1);
+
+		for (int32 Row = 1; Row <= Rows; ++Row)
+		{
+			RowForCol[0] = Row;
+			int32 Col0 = 0;
+			MinV.Init(TNumericLimits<double>::Max(), Cols + 1);
+			Used.Init(false, Cols + 1);
+
+			do
+			{
+				Used[Col0] = true;
+				const int32 Row0 = RowForCol[Col0];
+				double Delta = TNumericLimits<double>::Max();
+				int32 Col1 = 0;
+
+				for (int32 Col = 1; Col <= Cols; ++Col)
+				{
+					if (Used[Col]) continue;
+
+					const double Reduced = Cost(Row0 - 1, Col - 1) - U[Row0] - V[Col];
+					if (Reduced < MinV[Col])
+					{
+						MinV[Col] = Reduced;
+						Way[Col] = Col0;
+					}
+					if (MinV[Col] < Delta)
+					{
+						Delta = MinV[Col];
+						Col1 = Col;
+					}
+				}
+
+				for (int32 Col = 0; Col <= Cols; ++Col)
+				{
+					if (Used[Col])
+					{
+						U[RowForCol[Col]] += Delta;
+						V[Col] -= Delta;
+					}
+					else
+					{
+						MinV[Col] -= Delta;
+					}
+				}
+
+				Col0 = Col1;
+			}
+			while (RowForCol[Col0] != 0);
+
+			// Augment along the alternating path
+			do
+			{
+				const int32 Col1 = Way[Col0];
+				RowForCol[Col0] = RowForCol[Col1];
+				Col0 = Col1;
+			}
+			while (Col0 != 0);
+		}
+
+		for (int32 Col = 1; Col <= Cols; ++Col)
+		{
+			const int32 Row = RowForCol[Col];
+			if (Row == 0) continue;
+
+			const int32 Worker = bTransposed ? Col - 1 : Row - 1;
+			const int32 Slot = bTransposed ? Row - 1 : Col - 1;
+			if (Matrix.IsFeasible(Worker, Slot))
+			{
+				OutSlotForWorker[Worker] = Slot;
+			}
+		}
+	}
+
+	bool SolveGreedy(const FCostMatrix& Matrix, double TimeBudgetSeconds, TArray<int32>& OutSlotForWorker,
+		int32 MaxPairsPerWorker)
+	{
+		// The budget covers building and sorting the pair list, not just the matching pass
+		const double Deadline = TimeBudgetSeconds > 0.0
+			? FPlatformTime::Seconds() + TimeBudgetSeconds
+			: TNumericLimits<double>::Max();
+
+		OutSlotForWorker.Init(INDEX_NONE, Matrix.NumWorkers);
+
+		struct FPair
+		{
+			float Cost;
+			int32 Worker;
+			int32 Slot;
+		};
+
+		const int32 PairsPerWorker = MaxPairsPerWorker > 0
+			? FMath::Min(MaxPairsPerWorker, Matrix.NumSlots)
+			: Matrix.NumSlots;
+
+		// Each worker keeps only its cheapest PairsPerWorker slots — max-heap on cost
+		auto MoreExpensive = [](const FPair& A, const FPair& B) { return A.Cost > B.Cost; };
+
+		TArray<FPair> Pairs;
+		Pairs.Reserve(Matrix.NumWorkers * PairsPerWorker);
+		TArray<FPair> Row;
+		Row.Reserve(PairsPerWorker);
+
+		bool bWithinBudget = true;
+		for (int32 Worker = 0; Worker < Matrix.NumWorkers; ++Worker)
+		{
+			if (FPlatformTime::Seconds() > Deadline)
+			{
+				// Rows not reached yet wait for the next cycle
+				bWithinBudget = false;
+				break;
+			}
+
+			Row.Reset();
+			for (int32 Slot = 0; Slot < Matrix.NumSlots; ++Slot)
+			{
+				if (!Matrix.IsFeasible(Worker, Slot)) continue;
+
+				const FPair Pair{ Matrix.Get(Worker, Slot), Worker, Slot };
+				if (Row.Num() < PairsPerWorker)
+				{
+					Row.HeapPush(Pair, MoreExpensive);
+				}
+				else if (Pair.Cost < Row.HeapTop().Cost)
+				{
+					Row.HeapPopDiscard(MoreExpensive, EAllowShrinking::No);
+					Row.HeapPush(Pair, MoreExpensive);
+				}
+			}
+			Pairs.Append(Row);
+		}
+
+		Pairs.Sort([](const FPair& A, const FPair& B) { return A.Cost < B.Cost; });
+
+		TBitArray<> SlotTaken(false, Matrix.NumSlots);
+		int32 Remaining = FMath::Min(Matrix.NumWorkers, Matrix.NumSlots);
+
+		for (int32 Index = 0; Index < Pairs.Num() && Remaining > 0; ++Index)
+		{
+			// Checking the clock is not free — sample it every 256 pairs
+			if (bWithinBudget && (Index & 255) == 255 && FPlatformTime::Seconds() > Deadline)
+			{
+				return false;
+			}
+
+			const FPair& Pair = Pairs[Index];
+			if (OutSlotForWorker[Pair.Worker] != INDEX_NONE || SlotTaken[Pair.Slot]) continue;
+
+			OutSlotForWorker[Pair.Worker] = Pair.Slot;
+			SlotTaken[Pair.Slot] = true;
+			--Remaining;
+		}
+
+		return bWithinBudget;
+	}
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// ─────────────────────────────────────────────────────────
+// ForemanAssignment — worker × slot assignment solvers
+//   Used by FForemanTask_PlanJob in batch mode. The caller
+//   builds a row-major cost matrix (one row per worker, one
+//   column per slot) and gets back one slot index per worker,
+//   INDEX_NONE where the worker stays unassigned.
+//   Pairs marked Infeasible (capability mismatch) are never matched.
+// ─────────────────────────────────────────────────────────
+namespace ForemanAssignment
+{
+	/** Cost value for a worker/slot pair that must never be assigned. */
+	inline constexpr float Infeasible = TNumericLimits<float>::Max();
+
+	struct FCostMatrix
+	{
+		int32 NumWorkers = 0;
+		int32 NumSlots = 0;
+		TArray<float> Costs;
+
+		void Init(int32 InNumWorkers, int32 InNumSlots)
+		{
+			NumWorkers = InNumWorkers;
+			NumSlots = InNumSlots;
+			Costs.Init(Infeasible, NumWorkers * NumSlots);
+		}
+
+		float Get(int32 Worker, int32 Slot) const { return Costs[Worker * NumSlots + Slot]; }
+		void Set(int32 Worker, int32 Slot, float Cost) { Costs[Worker * NumSlots + Slot] = Cost; }
+		bool IsFeasible(int32 Worker, int32 Slot) const { return Get(Worker, Slot) < Infeasible; }
+	};
+
+	/**
+	 * Minimum total cost assignment (Hungarian / Kuhn-Munkres, O(n²m)).
+	 * Maximises the number of feasible matches first, then minimises cost.
+	 */
+	void SolveOptimal(const FCostMatrix& Matrix, TArray<int32>& OutSlotForWorker);
+
+	/**
+	 * Cheapest-pair-first greedy matching over each worker's MaxPairsPerWorker
+	 * cheapest slots (0 = all). TimeBudgetSeconds (0 = no budget) covers the
+	 * pair build and sort as well as the matching; once it is spent the solver
+	 * returns false — pairs matched so far are still valid.
+	 */
+	bool SolveGreedy(const FCostMatrix& Matrix, double TimeBudgetSeconds, TArray<int32>& OutSlotForWorker,
+		int32 MaxPairsPerWorker = 0);
+}
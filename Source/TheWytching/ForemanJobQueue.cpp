@@ -0,0 +1,488 @@
+#include "ForemanJobQueue.h"
+
+#include "ForemanTypes.h"
+#include "ForemanWorkSnapshot.h"
+#include "ForemanWorkerRoster.h"
+#include "ForemanSlotIndexSubsystem.h"
+#include "IWytchWorkSite.h"
+#include "WytchLatencyStats.h"
+#include "GameFramework/Actor.h"
+
+namespace
+{
+	/** Exact task type first, then its nearest ancestor with a policy. */
+	const FForemanJobPolicy& ResolvePolicy(FGameplayTag TaskType,
+		const TMap<FGameplayTag, FForemanJobPolicy>& Policies,
+		const FForemanJobPolicy& DefaultPolicy)
+	{
+		for (FGameplayTag Tag = TaskType; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+		{
+			if (const FForemanJobPolicy* Policy = Policies.Find(Tag))
+			{
+				return *Policy;
+			}
+		}
+		return DefaultPolicy;
+	}
+}
+
+bool FForemanJobQueue::IsHigherRanked(const FForemanJob& A, const FForemanJob& B)
+{
+	if (A.Priority != B.Priority)
+	{
+		return A.Priority > B.Priority;
+	}
+	if (A.HasDeadline() != B.HasDeadline())
+	{
+		return A.HasDeadline();
+	}
+	if (A.HasDeadline() && A.Deadline != B.Deadline)
+	{
+		return A.Deadline < B.Deadline;
+	}
+	if (A.CreatedTime != B.CreatedTime)
+	{
+		return A.CreatedTime < B.CreatedTime;
+	}
+	return A.Id < B.Id;
+}
+
+// ─────────────────────────────────────────────────────────
+// Sync
+// ─────────────────────────────────────────────────────────
+
+void FForemanJobQueue::Sync(const FForemanWorkSnapshot& Snapshot,
+	const UForemanSlotIndexSubsystem& SlotIndex,
+	const FForemanWorkerRoster& Roster,
+	const TMap<FGameplayTag, FForemanJobPolicy>& Policies,
+	const FForemanJobPolicy& DefaultPolicy,
+	double Now)
+{
+	// ── 1. Assigned jobs — catch up with workers that don't broadcast ──
+	TArray<TPair<TWeakObjectPtr<AActor>, EWorkerState>> WorkerStates;
+	WorkerStates.Reserve(JobByWorker.Num() + FollowUpByWorker.Num());
+	for (const TPair<TWeakObjectPtr<AActor>, FSmartObjectSlotHandle>& Pair : JobByWorker)
+	{
+		WorkerStates.Emplace(Pair.Key, Roster.GetState(Pair.Key.Get()));
+	}
+	for (const TPair<TWeakObjectPtr<AActor>, FSmartObjectSlotHandle>& Pair : FollowUpByWorker)
+	{
+		if (!JobByWorker.Contains(Pair.Key))
+		{
+			WorkerStates.Emplace(Pair.Key, Roster.GetState(Pair.Key.Get()));
+		}
+	}
+	for (const TPair<TWeakObjectPtr<AActor>, EWorkerState>& WorkerState : WorkerStates)
+	{
+		if (AActor* Worker = WorkerState.Key.Get())
+		{
+			HandleWorkerStateChanged(Worker, WorkerState.Value, Now);
+		}
+		else
+		{
+			// Worker destroyed mid-job
+			if (const FSmartObjectSlotHandle* Handle = JobByWorker.Find(WorkerState.Key))
+			{
+				if (FForemanJob* Job = Jobs.Find(*Handle))
+				{
+					ReleaseWorker(*Job);
+				}
+			}
+			FSmartObjectSlotHandle FollowUp;
+			if (RemoveFollowUp(WorkerState.Key, FollowUp))
+			{
+				if (FForemanJob* Job = Jobs.Find(FollowUp))
+				{
+					Job->Status = EForemanJobStatus::Pending;
+					Job->Worker.Reset();
+				}
+			}
+			ReleaseChainedReservation(WorkerState.Key);
+		}
+	}
+
+	// ── 2. Pending jobs whose slot was taken or left the zone ──
+	const TSet<FSmartObjectSlotHandle> FreeSlots(Snapshot.FreeSlots);
+	for (auto It = Jobs.CreateIterator(); It; ++It)
+	{
+		if (It->Value.Status == EForemanJobStatus::Pending && !FreeSlots.Contains(It->Key))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// ── 3. New jobs for newly free slots ──
+	for (const FSmartObjectSlotHandle& SlotHandle : Snapshot.FreeSlots)
+	{
+		if (Jobs.Contains(SlotHandle)) continue;
+
+		const FForemanIndexedSlot* Slot = SlotIndex.FindSlot(SlotHandle);
+		if (!Slot) continue;
+
+		FForemanJob& Job = Jobs.Add(SlotHandle);
+		Job.Id = NextJobId++;
+		Job.SlotHandle = SlotHandle;
+		Job.Site = Slot->Owner;
+		Job.RequirementMask = Slot->RequirementMask;
+		Job.Location = Slot->Location;
+		Job.CreatedTime = Now;
+
+		AActor* Site = Slot->Owner.Get();
+		if (Site && Site->Implements<UWytchWorkSite>())
+		{
+			Job.TaskType = IWytchWorkSite::Execute_GetTaskType(Site);
+		}
+
+		const FForemanJobPolicy& Policy = ResolvePolicy(Job.TaskType, Policies, DefaultPolicy);
+		Job.Priority = Policy.Priority;
+		Job.Deadline = Policy.DeadlineSeconds > 0.f ? Now + Policy.DeadlineSeconds : 0.0;
+
+		++NumCreated;
+	}
+
+	// ── 4. Deadlines ──
+	for (TPair<FSmartObjectSlotHandle, FForemanJob>& Pair : Jobs)
+	{
+		FForemanJob& Job = Pair.Value;
+		if (Job.HasDeadline() && !Job.bDeadlineMissed &&
+			Job.Status != EForemanJobStatus::InProgress && Now > Job.Deadline)
+		{
+			Job.bDeadlineMissed = true;
+			++NumDeadlinesMissed;
+			UE_LOG(LogForeman, Warning, TEXT("JobQueue: job %d (%s, priority %d) missed its deadline by %.1fs"),
+				Job.Id, *Job.TaskType.ToString(), Job.Priority, Now - Job.Deadline);
+		}
+	}
+}
+
+void FForemanJobQueue::Reset()
+{
+	if (UForemanSlotIndexSubsystem* SlotIndex = ReservationIndex.Get())
+	{
+		for (const TPair<TWeakObjectPtr<AActor>, FSmartObjectSlotHandle>& Pair : FollowUpByWorker)
+		{
+			SlotIndex->UnreserveSlot(Pair.Value);
+		}
+		for (const TPair<TWeakObjectPtr<AActor>, FSmartObjectSlotHandle>& Pair : ChainedByWorker)
+		{
+			SlotIndex->UnreserveSlot(Pair.Value);
+		}
+	}
+
+	Jobs.Reset();
+	JobByWorker.Reset();
+	FollowUpByWorker.Reset();
+	ChainedByWorker.Reset();
+	ReservationIndex.Reset();
+}
+
+// ─────────────────────────────────────────────────────────
+// Queries
+// ─────────────────────────────────────────────────────────
+
+void FForemanJobQueue::GetPendingJobs(TArray<const FForemanJob*>& OutJobs) const
+{
+	OutJobs.Reset();
+	for (const TPair<FSmartObjectSlotHandle, FForemanJob>& Pair : Jobs)
+	{
+		if (Pair.Value.Status == EForemanJobStatus::Pending)
+		{
+			OutJobs.Add(&Pair.Value);
+		}
+	}
+	OutJobs.Sort([](const FForemanJob& A, const FForemanJob& B) { return IsHigherRanked(A, B); });
+}
+
+const FForemanJob* FForemanJobQueue::FindJobForWorker(AActor* Worker) const
+{
+	const FSmartObjectSlotHandle* Handle = JobByWorker.Find(Worker);
+	return Handle ? Jobs.Find(*Handle) : nullptr;
+}
+
+int32 FForemanJobQueue::GetNumPending() const
+{
+	return Jobs.Num() - JobByWorker.Num() - FollowUpByWorker.Num();
+}
+
+void FForemanJobQueue::GetWorkersFinishingWithin(double Now, float LeadTime, TArray<const FForemanJob*>& OutJobs) const
+{
+	OutJobs.Reset();
+	for (const TPair<TWeakObjectPtr<AActor>, FSmartObjectSlotHandle>& Pair : JobByWorker)
+	{
+		const FForemanJob* Job = Jobs.Find(Pair.Value);
+		if (!Job || Job->Status != EForemanJobStatus::InProgress || !Pair.Key.IsValid()) continue;
+		if (FollowUpByWorker.Contains(Pair.Key)) continue;
+
+		// 0 = instant — the worker is already leaving, nothing to overlap
+		if (Job->WorkDuration <= 0.f) continue;
+
+		const double Remaining = Job->ArrivedTime + Job->WorkDuration - Now;
+		if (Remaining <= LeadTime)
+		{
+			OutJobs.Add(Job);
+		}
+	}
+}
+
+FForemanJobQueueStats FForemanJobQueue::GetStats() const
+{
+	FForemanJobQueueStats Stats;
+	Stats.NumPending = GetNumPending();
+	Stats.NumAssigned = JobByWorker.Num();
+	Stats.NumCreated = NumCreated;
+	Stats.NumArrived = NumArrived;
+	Stats.NumCompleted = NumCompleted;
+	Stats.NumPreempted = NumPreempted;
+	Stats.NumChained = NumChained;
+	Stats.NumDeadlinesMissed = NumDeadlinesMissed;
+	Stats.AverageWaitSeconds = NumArrived > 0 ? float(TotalWaitSeconds / NumArrived) : 0.f;
+	Stats.AverageLatencySeconds = NumArrived > 0 ? float(TotalLatencySeconds / NumArrived) : 0.f;
+	Stats.MaxLatencySeconds = float(MaxLatencySeconds);
+	return Stats;
+}
+
+// ─────────────────────────────────────────────────────────
+// Job lifecycle
+// ─────────────────────────────────────────────────────────
+
+void FForemanJobQueue::MarkAssigned(FSmartObjectSlotHandle SlotHandle, AActor* Worker, double Now)
+{
+	FForemanJob* Job = Jobs.Find(SlotHandle);
+	if (!Job || !Worker) return;
+
+	// A worker holds one job at a time
+	if (const FSmartObjectSlotHandle* Previous = JobByWorker.Find(Worker))
+	{
+		if (FForemanJob* PreviousJob = Jobs.Find(*Previous))
+		{
+			ReleaseWorker(*PreviousJob);
+		}
+	}
+
+	ReleaseFollowUp(Worker);
+	ReleaseChainedReservation(Worker);
+
+	Job->Status = EForemanJobStatus::Assigned;
+	Job->Worker = Worker;
+	Job->AssignedTime = Now;
+	JobByWorker.Add(Worker, SlotHandle);
+
+	FWytchLatencyStats::Record(EWytchLatencyStage::JobAssign, Now - Job->CreatedTime);
+}
+
+void FForemanJobQueue::MarkReserved(FSmartObjectSlotHandle SlotHandle, AActor* Worker, UForemanSlotIndexSubsystem& SlotIndex)
+{
+	FForemanJob* Job = Jobs.Find(SlotHandle);
+	if (!Job || !Worker || Job->Status != EForemanJobStatus::Pending) return;
+
+	ReleaseFollowUp(Worker);
+
+	Job->Status = EForemanJobStatus::Reserved;
+	Job->Worker = Worker;
+	FollowUpByWorker.Add(Worker, SlotHandle);
+
+	// Not claimed until the worker chains into it — keep other dispatchers off the slot meanwhile
+	ReservationIndex = &SlotIndex;
+	SlotIndex.ReserveSlot(SlotHandle);
+}
+
+void FForemanJobQueue::HandleWorkerStateChanged(AActor* Worker, EWorkerState NewState, double Now)
+{
+	FForemanJob* Job = FindMutableJobForWorker(Worker);
+
+	// A chained trip has ended — claimed on arrival (Working) or abandoned
+	if (NewState != EWorkerState::MovingToTask)
+	{
+		ReleaseChainedReservation(Worker);
+	}
+
+	switch (NewState)
+	{
+	case EWorkerState::Working:
+		if (Job && Job->Status == EForemanJobStatus::Assigned)
+		{
+			Job->Status = EForemanJobStatus::InProgress;
+			Job->ArrivedTime = Now;
+
+			AActor* Site = Job->Site.Get();
+			Job->WorkDuration = Site && Site->Implements<UWytchWorkSite>()
+				? IWytchWorkSite::Execute_GetInteractionDuration(Site)
+				: 0.f;
+
+			const double Latency = Now - Job->CreatedTime;
+			++NumArrived;
+			TotalWaitSeconds += Job->AssignedTime - Job->CreatedTime;
+			TotalLatencySeconds += Latency;
+			MaxLatencySeconds = FMath::Max(MaxLatencySeconds, Latency);
+			FWytchLatencyStats::Record(EWytchLatencyStage::JobTravel, Now - Job->AssignedTime);
+
+			UE_LOG(LogForeman, Verbose, TEXT("JobQueue: job %d reached by %s — latency %.2fs"),
+				Job->Id, *Worker->GetName(), Latency);
+		}
+		break;
+
+	case EWorkerState::MovingToTask:
+		if (Job && Job->Status == EForemanJobStatus::InProgress)
+		{
+			// Left the site without going idle — chained into its follow-up
+			FWytchLatencyStats::Record(EWytchLatencyStage::JobWork, Now - Job->ArrivedTime);
+			CompleteJob(*Job);
+
+			// Not claimed until arrival — the slot stays reserved for the trip
+			FSmartObjectSlotHandle FollowUp;
+			if (FollowUpByWorker.RemoveAndCopyValue(Worker, FollowUp))
+			{
+				ChainedByWorker.Add(Worker, FollowUp);
+				if (FForemanJob* Next = Jobs.Find(FollowUp))
+				{
+					Next->Status = EForemanJobStatus::Assigned;
+					Next->AssignedTime = Now;
+					JobByWorker.Add(Worker, FollowUp);
+					++NumChained;
+					FWytchLatencyStats::Record(EWytchLatencyStage::JobAssign, Now - Next->CreatedTime);
+				}
+			}
+		}
+		break;
+
+	case EWorkerState::Idle:
+	case EWorkerState::Unavailable:
+		if (Job)
+		{
+			if (Job->Status == EForemanJobStatus::InProgress)
+			{
+				// Done — a slot freed by completion comes back as a new job on the next sync
+				FWytchLatencyStats::Record(EWytchLatencyStage::JobWork, Now - Job->ArrivedTime);
+				CompleteJob(*Job);
+			}
+			else
+			{
+				// Never arrived (claim failed, path blocked, lost power) — back in the queue
+				ReleaseWorker(*Job);
+			}
+		}
+		// Did not chain — the reserved follow-up is up for grabs again
+		ReleaseFollowUp(Worker);
+		break;
+
+	default:
+		break;
+	}
+}
+
+AActor* FForemanJobQueue::FindPreemptionCandidate(const FForemanJob& Job, const FForemanWorkerRoster& Roster) const
+{
+	const FForemanJob* Best = nullptr;
+	double BestDistSq = TNumericLimits<double>::Max();
+
+	for (const TPair<TWeakObjectPtr<AActor>, FSmartObjectSlotHandle>& Pair : JobByWorker)
+	{
+		AActor* Worker = Pair.Key.Get();
+		const FForemanJob* Victim = Jobs.Find(Pair.Value);
+		if (!Worker || !Victim || Victim->Priority >= Job.Priority) continue;
+		if (Roster.GetState(Worker) == EWorkerState::Unavailable) continue;
+		if (!Roster.GetCapabilityMask(Worker).Covers(Job.RequirementMask)) continue;
+
+		const double DistSq = FVector::DistSquared(Worker->GetActorLocation(), Job.Location);
+		if (Best)
+		{
+			if (Victim->Priority != Best->Priority)
+			{
+				if (Victim->Priority > Best->Priority) continue;
+			}
+			else if (Victim->Status != Best->Status)
+			{
+				// Travelling workers lose nothing but the walk
+				if (Victim->Status != EForemanJobStatus::Assigned) continue;
+			}
+			else if (DistSq >= BestDistSq)
+			{
+				continue;
+			}
+		}
+
+		Best = Victim;
+		BestDistSq = DistSq;
+	}
+
+	return Best ? Best->Worker.Get() : nullptr;
+}
+
+void FForemanJobQueue::MarkPreempted(AActor* Worker)
+{
+	const FSmartObjectSlotHandle* Handle = JobByWorker.Find(Worker);
+	FForemanJob* Job = Handle ? Jobs.Find(*Handle) : nullptr;
+	if (!Job) return;
+
+	UE_LOG(LogForeman, Log, TEXT("JobQueue: job %d (priority %d) preempted — %s reassigned"),
+		Job->Id, Job->Priority, *Worker->GetName());
+
+	++NumPreempted;
+	ReleaseWorker(*Job);
+	ReleaseFollowUp(Worker);
+	ReleaseChainedReservation(Worker);
+}
+
+FForemanJob* FForemanJobQueue::FindMutableJobForWorker(AActor* Worker)
+{
+	const FSmartObjectSlotHandle* Handle = JobByWorker.Find(Worker);
+	if (!Handle) return nullptr;
+
+	FForemanJob* Job = Jobs.Find(*Handle);
+	if (!Job)
+	{
+		JobByWorker.Remove(Worker);
+	}
+	return Job;
+}
+
+void FForemanJobQueue::CompleteJob(FForemanJob& Job)
+{
+	++NumCompleted;
+	JobByWorker.Remove(Job.Worker);
+	Jobs.Remove(Job.SlotHandle);
+}
+
+bool FForemanJobQueue::RemoveFollowUp(const TWeakObjectPtr<AActor>& Worker, FSmartObjectSlotHandle& OutSlotHandle)
+{
+	if (!FollowUpByWorker.RemoveAndCopyValue(Worker, OutSlotHandle)) return false;
+
+	// Never chained — the slot is free again unless someone else claimed it meanwhile
+	if (UForemanSlotIndexSubsystem* SlotIndex = ReservationIndex.Get())
+	{
+		SlotIndex->UnreserveSlot(OutSlotHandle);
+	}
+	return true;
+}
+
+void FForemanJobQueue::ReleaseChainedReservation(const TWeakObjectPtr<AActor>& Worker)
+{
+	FSmartObjectSlotHandle SlotHandle;
+	if (!ChainedByWorker.RemoveAndCopyValue(Worker, SlotHandle)) return;
+
+	// On Working the worker's claim keeps the slot taken; otherwise it is free again
+	if (UForemanSlotIndexSubsystem* SlotIndex = ReservationIndex.Get())
+	{
+		SlotIndex->UnreserveSlot(SlotHandle);
+	}
+}
+
+void FForemanJobQueue::ReleaseFollowUp(AActor* Worker)
+{
+	FSmartObjectSlotHandle FollowUp;
+	if (!RemoveFollowUp(Worker, FollowUp)) return;
+
+	if (FForemanJob* Job = Jobs.Find(FollowUp))
+	{
+		Job->Status = EForemanJobStatus::Pending;
+		Job->Worker.Reset();
+	}
+}
+
+void FForemanJobQueue::ReleaseWorker(FForemanJob& Job)
+{
+	JobByWorker.Remove(Job.Worker);
+	Job.Status = EForemanJobStatus::Pending;
+	Job.Worker.Reset();
+	Job.AssignedTime = 0.0;
+}
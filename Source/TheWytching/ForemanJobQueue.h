@@ -0,0 +1,242 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "SmartObjectRuntime.h"
+#include "AndroidTypes.h"
+#include "WytchCapabilityMask.h"
+#include "ForemanJobQueue.generated.h"
+
+class AActor;
+class FForemanWorkerRoster;
+class UForemanSlotIndexSubsystem;
+struct FForemanWorkSnapshot;
+
+// ─────────────────────────────────────────────────────────
+// FForemanJobPolicy — how jobs of one task type are ranked
+// ─────────────────────────────────────────────────────────
+USTRUCT(BlueprintType)
+struct FForemanJobPolicy
+{
+	GENERATED_BODY()
+
+	/** Higher runs first. A pending job may preempt workers on strictly lower-priority jobs. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Job")
+	int32 Priority = 0;
+
+	/** Seconds after creation the job should have a worker on site. 0 = no deadline. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Job", meta = (ClampMin = "0.0"))
+	float DeadlineSeconds = 0.f;
+};
+
+// ─────────────────────────────────────────────────────────
+// FForemanJobQueueStats — running queue metrics
+//   Latency = job creation → assigned worker arriving on site.
+// ─────────────────────────────────────────────────────────
+USTRUCT(BlueprintType)
+struct FForemanJobQueueStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Job")
+	int32 NumPending = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Job")
+	int32 NumAssigned = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Job")
+	int32 NumCreated = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Job")
+	int32 NumArrived = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Job")
+	int32 NumCompleted = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Job")
+	int32 NumPreempted = 0;
+
+	/** Jobs a worker chained into straight from its previous job, with no idle gap. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Job")
+	int32 NumChained = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Job")
+	int32 NumDeadlinesMissed = 0;
+
+	/** Mean creation → assignment time over arrived jobs. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Job")
+	float AverageWaitSeconds = 0.f;
+
+	/** Mean creation → arrival time over arrived jobs. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Job")
+	float AverageLatencySeconds = 0.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Job")
+	float MaxLatencySeconds = 0.f;
+};
+
+enum class EForemanJobStatus : uint8
+{
+	/** Waiting for a worker. */
+	Pending,
+	/** Worker dispatched, not yet on site. */
+	Assigned,
+	/** Worker on site and working. */
+	InProgress,
+	/** Held as the follow-up for a worker finishing another job. */
+	Reserved
+};
+
+// ─────────────────────────────────────────────────────────
+// FForemanJob — one unit of work on one SmartObject slot
+// ─────────────────────────────────────────────────────────
+struct FForemanJob
+{
+	int32 Id = 0;
+	FSmartObjectSlotHandle SlotHandle;
+
+	/** The IWytchWorkSite owning the slot. */
+	TWeakObjectPtr<AActor> Site;
+
+	/** IWytchWorkSite::GetTaskType of the site. Empty for non-worksite slots. */
+	FGameplayTag TaskType;
+
+	FWytchCapabilityMask RequirementMask;
+	FVector Location = FVector::ZeroVector;
+
+	int32 Priority = 0;
+
+	/** World time the job entered the queue. Kept across preemption so age is not reset. */
+	double CreatedTime = 0.0;
+
+	/** World time the job is due. 0 = none. */
+	double Deadline = 0.0;
+
+	EForemanJobStatus Status = EForemanJobStatus::Pending;
+	TWeakObjectPtr<AActor> Worker;
+	double AssignedTime = 0.0;
+
+	/** World time the worker arrived, and the site's interaction duration then. */
+	double ArrivedTime = 0.0;
+	float WorkDuration = 0.f;
+
+	bool bDeadlineMissed = false;
+
+	bool HasDeadline() const { return Deadline > 0.0; }
+};
+
+// ─────────────────────────────────────────────────────────
+// FForemanJobQueue — the Foreman's persistent job backlog
+//   Synced from the work snapshot once per scan: every free slot
+//   in the work zone becomes a pending job ranked by its task
+//   type's policy; jobs whose slot was taken by someone else drop
+//   out. Dispatch moves a job to Assigned, the worker arriving
+//   (→ Working) moves it to InProgress and records latency, and
+//   the worker going idle completes it (or, before arrival,
+//   returns it to Pending with its original age).
+//
+//   A worker close to finishing can hold one Reserved follow-up
+//   job. Its slot is reserved in the shared slot index so other
+//   Foremen and Mass dispatch leave it alone. When the worker
+//   leaves the site for that job (Working → MovingToTask) the
+//   current job completes and the follow-up becomes Assigned; if
+//   it goes idle instead, the follow-up returns to Pending.
+//   Workers only claim on arrival, so a chained follow-up stays
+//   reserved for the whole trip and is released once the worker
+//   reaches any other state (Working = claimed, Idle/Unavailable
+//   = gave up).
+//
+//   Ordering: priority (high first), then deadline (soonest first,
+//   none last), then age (oldest first).
+// ─────────────────────────────────────────────────────────
+class THEWYTCHING_API FForemanJobQueue
+{
+public:
+	/**
+	 * Adds jobs for new free slots, drops pending jobs whose slot is no
+	 * longer free, and reconciles assigned jobs against the roster (for
+	 * workers that do not broadcast state changes).
+	 */
+	void Sync(const FForemanWorkSnapshot& Snapshot,
+		const UForemanSlotIndexSubsystem& SlotIndex,
+		const FForemanWorkerRoster& Roster,
+		const TMap<FGameplayTag, FForemanJobPolicy>& Policies,
+		const FForemanJobPolicy& DefaultPolicy,
+		double Now);
+
+	void Reset();
+
+	/** Pending jobs in dispatch order. */
+	void GetPendingJobs(TArray<const FForemanJob*>& OutJobs) const;
+
+	const FForemanJob* FindJob(FSmartObjectSlotHandle SlotHandle) const { return Jobs.Find(SlotHandle); }
+	const FForemanJob* FindJobForWorker(AActor* Worker) const;
+
+	/** Records a dispatch. No-op if the slot has no queued job. */
+	void MarkAssigned(FSmartObjectSlotHandle SlotHandle, AActor* Worker, double Now);
+
+	/** Holds a pending job as Worker's next job and reserves its slot in SlotIndex. */
+	void MarkReserved(FSmartObjectSlotHandle SlotHandle, AActor* Worker, UForemanSlotIndexSubsystem& SlotIndex);
+
+	/**
+	 * Workers on site whose job ends within LeadTime seconds (by the site's
+	 * GetInteractionDuration) and that hold no follow-up yet.
+	 */
+	void GetWorkersFinishingWithin(double Now, float LeadTime, TArray<const FForemanJob*>& OutJobs) const;
+
+	/** Worker state change — arrival, completion or abandonment of its job. */
+	void HandleWorkerStateChanged(AActor* Worker, EWorkerState NewState, double Now);
+
+	/**
+	 * Best worker to take off lower-priority work for Job: on a strictly
+	 * lower-priority job, able to cover Job's requirements. Prefers the
+	 * lowest priority, then workers still travelling, then the nearest.
+	 */
+	AActor* FindPreemptionCandidate(const FForemanJob& Job, const FForemanWorkerRoster& Roster) const;
+
+	/** Returns the worker's job (and follow-up) to Pending after the Foreman aborted it. */
+	void MarkPreempted(AActor* Worker);
+
+	int32 Num() const { return Jobs.Num(); }
+	int32 GetNumPending() const;
+
+	FForemanJobQueueStats GetStats() const;
+
+	/** Orders A before B in dispatch order. */
+	static bool IsHigherRanked(const FForemanJob& A, const FForemanJob& B);
+
+private:
+	FForemanJob* FindMutableJobForWorker(AActor* Worker);
+	void ReleaseWorker(FForemanJob& Job);
+	void ReleaseFollowUp(AActor* Worker);
+
+	/** Forgets Worker's follow-up and drops its slot reservation. False if it held none. */
+	bool RemoveFollowUp(const TWeakObjectPtr<AActor>& Worker, FSmartObjectSlotHandle& OutSlotHandle);
+
+	/** Drops the reservation held for Worker's trip to a chained follow-up, if any. */
+	void ReleaseChainedReservation(const TWeakObjectPtr<AActor>& Worker);
+	void CompleteJob(FForemanJob& Job);
+
+	TMap<FSmartObjectSlotHandle, FForemanJob> Jobs;
+	TMap<TWeakObjectPtr<AActor>, FSmartObjectSlotHandle> JobByWorker;
+	TMap<TWeakObjectPtr<AActor>, FSmartObjectSlotHandle> FollowUpByWorker;
+
+	/** Chained follow-ups still travelling — reserved until the worker claims or gives up. */
+	TMap<TWeakObjectPtr<AActor>, FSmartObjectSlotHandle> ChainedByWorker;
+
+	/** Index the follow-up slots are reserved in. */
+	TWeakObjectPtr<UForemanSlotIndexSubsystem> ReservationIndex;
+
+	int32 NextJobId = 1;
+
+	// Metrics
+	int32 NumCreated = 0;
+	int32 NumArrived = 0;
+	int32 NumCompleted = 0;
+	int32 NumPreempted = 0;
+	int32 NumChained = 0;
+	int32 NumDeadlinesMissed = 0;
+	double TotalWaitSeconds = 0.0;
+	double TotalLatencySeconds = 0.0;
+	double MaxLatencySeconds = 0.0;
+};
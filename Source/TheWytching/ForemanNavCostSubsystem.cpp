@@ -0,0 +1,173 @@
+#include "ForemanNavCostSubsystem.h"
+
+#include "ForemanTypes.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "Engine/World.h"
+
+UForemanNavCostSubsystem* UForemanNavCostSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UForemanNavCostSubsystem>() : nullptr;
+}
+
+bool UForemanNavCostSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UForemanNavCostSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UForemanNavCostSubsystem, STATGROUP_Tickables);
+}
+
+void UForemanNavCostSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// A rebuilt navmesh invalidates every cached length
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.AddDynamic(
+			this, &UForemanNavCostSubsystem::OnNavigationGenerationFinished);
+	}
+}
+
+void UForemanNavCostSubsystem::Deinitialize()
+{
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->OnNavigationGenerationFinishedDelegate.RemoveDynamic(
+			this, &UForemanNavCostSubsystem::OnNavigationGenerationFinished);
+	}
+
+	ClearCache();
+	Super::Deinitialize();
+}
+
+void UForemanNavCostSubsystem::ClearCache()
+{
+	Cache.Reset();
+	PendingQueue.Reset();
+	Queued.Reset();
+	// In-flight results arrive to an empty map and are dropped
+	InFlight.Reset();
+}
+
+void UForemanNavCostSubsystem::OnNavigationGenerationFinished(ANavigationData* NavData)
+{
+	UE_LOG(LogForeman, Log, TEXT("NavCost: navigation rebuilt — dropping %d cached paths"), Cache.Num());
+	ClearCache();
+}
+
+UForemanNavCostSubsystem::FTilePairKey UForemanNavCostSubsystem::MakeKey(const FVector& From, const FVector& To) const
+{
+	auto Quantize = [this](const FVector& Location)
+	{
+		return FIntVector(
+			FMath::FloorToInt32(Location.X / TileSize),
+			FMath::FloorToInt32(Location.Y / TileSize),
+			FMath::FloorToInt32(Location.Z / TileSize));
+	};
+	return { Quantize(From), Quantize(To) };
+}
+
+// ─────────────────────────────────────────────────────────
+// Lookup
+// ─────────────────────────────────────────────────────────
+
+float UForemanNavCostSubsystem::GetTravelCost(const FVector& From, const FVector& To, EForemanNavCostStatus* OutStatus)
+{
+	const FTilePairKey Key = MakeKey(From, To);
+
+	if (const FCachedCost* Cached = Cache.Find(Key))
+	{
+		const double Now = GetWorld()->GetTimeSeconds();
+		if (Now - Cached->Time <= CacheLifetime)
+		{
+			if (OutStatus)
+			{
+				*OutStatus = Cached->bReachable ? EForemanNavCostStatus::Exact : EForemanNavCostStatus::Unreachable;
+			}
+			return Cached->bReachable ? Cached->Length : TNumericLimits<float>::Max();
+		}
+		// Stale — keep serving it until the refresh lands
+	}
+
+	if (!Queued.Contains(Key))
+	{
+		Queued.Add(Key);
+		PendingQueue.Add({ Key, From, To });
+	}
+
+	// A stale result still beats a guess — an unreachable pair stays unreachable until re-queried
+	const FCachedCost* Stale = Cache.Find(Key);
+	if (OutStatus)
+	{
+		*OutStatus = Stale && !Stale->bReachable ? EForemanNavCostStatus::Unreachable : EForemanNavCostStatus::Estimated;
+	}
+
+	if (Stale)
+	{
+		return Stale->bReachable ? Stale->Length : TNumericLimits<float>::Max();
+	}
+	return FVector::Dist(From, To) * UnknownCostScale;
+}
+
+// ─────────────────────────────────────────────────────────
+// Budgeted query issue
+// ─────────────────────────────────────────────────────────
+
+void UForemanNavCostSubsystem::Tick(float DeltaTime)
+{
+	if (PendingQueue.IsEmpty())
+	{
+		return;
+	}
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	const ANavigationData* NavData = NavSys ? NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate) : nullptr;
+	if (!NavData)
+	{
+		return;
+	}
+
+	int32 Issued = 0;
+	int32 Consumed = 0;
+	while (Consumed < PendingQueue.Num() &&
+		Issued < MaxQueriesPerFrame &&
+		InFlight.Num() < MaxQueriesInFlight)
+	{
+		const FPendingQuery& Pending = PendingQueue[Consumed++];
+		Queued.Remove(Pending.Key);
+
+		FPathFindingQuery Query(this, *NavData, Pending.From, Pending.To);
+		Query.SetAllowPartialPaths(false);
+
+		const uint32 QueryId = NavSys->FindPathAsync(
+			FNavAgentProperties::DefaultProperties,
+			Query,
+			FNavPathQueryDelegate::CreateUObject(this, &UForemanNavCostSubsystem::OnPathFound));
+
+		if (QueryId != INVALID_NAVQUERYID)
+		{
+			InFlight.Add(QueryId, Pending.Key);
+			++Issued;
+		}
+	}
+
+	PendingQueue.RemoveAt(0, Consumed, EAllowShrinking::No);
+}
+
+void UForemanNavCostSubsystem::OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+{
+	FTilePairKey Key;
+	if (!InFlight.RemoveAndCopyValue(QueryId, Key))
+	{
+		return;  // Cache was cleared while the query ran
+	}
+
+	FCachedCost& Cached = Cache.FindOrAdd(Key);
+	Cached.Time = GetWorld()->GetTimeSeconds();
+	Cached.bReachable = Result == ENavigationQueryResult::Success && Path.IsValid() && !Path->IsPartial();
+	Cached.Length = Cached.bReachable ? Path->GetLength() : 0.f;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "ForemanNavCostSubsystem.generated.h"
+
+class ANavigationData;
+
+enum class EForemanNavCostStatus : uint8
+{
+	/** Path length from a completed query. */
+	Exact,
+	/** No result yet — straight-line estimate, query queued. */
+	Estimated,
+	/** Query found no complete path. */
+	Unreachable
+};
+
+/**
+ * Path-length cache for dispatch scoring.
+ *
+ * PlanJob asks for worker→slot travel costs; cached results come back
+ * immediately, misses return a straight-line estimate and queue an async
+ * FindPathAsync query. Queries are issued from Tick under a per-frame and
+ * in-flight budget, so scoring never waits on the navmesh. Results are
+ * cached per (from-tile, to-tile) pair and dropped after CacheLifetime or
+ * when navigation finishes rebuilding.
+ */
+UCLASS(Config = Game)
+class THEWYTCHING_API UForemanNavCostSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UForemanNavCostSubsystem* Get(const UWorld* World);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Travel cost From→To in world units. Never blocks: on a cache miss the
+	 * pair is queued and a straight-line estimate (× UnknownCostScale) returned;
+	 * an expired entry is re-queried and served meanwhile. Unreachable pairs —
+	 * fresh or expired — report Unreachable and return TNumericLimits<float>::Max(),
+	 * which callers must not scale.
+	 */
+	float GetTravelCost(const FVector& From, const FVector& To, EForemanNavCostStatus* OutStatus = nullptr);
+
+	void ClearCache();
+
+	int32 GetNumPending() const { return PendingQueue.Num() + InFlight.Num(); }
+
+	/** Side length of a cache tile in world units. Pairs in the same two tiles share a result. */
+	UPROPERTY(Config)
+	float TileSize = 400.f;
+
+	/** Max FindPathAsync calls issued per frame. */
+	UPROPERTY(Config)
+	int32 MaxQueriesPerFrame = 8;
+
+	/** Max queries outstanding at once. */
+	UPROPERTY(Config)
+	int32 MaxQueriesInFlight = 32;
+
+	/** Seconds before a cached path length is re-queried. */
+	UPROPERTY(Config)
+	float CacheLifetime = 30.f;
+
+	/** Multiplier on straight-line distance while a path is pending — paths are rarely straight. */
+	UPROPERTY(Config)
+	float UnknownCostScale = 1.25f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FTilePairKey
+	{
+		FIntVector From;
+		FIntVector To;
+
+		bool operator==(const FTilePairKey& Other) const { return From == Other.From && To == Other.To; }
+		friend uint32 GetTypeHash(const FTilePairKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.From), GetTypeHash(Key.To));
+		}
+	};
+
+	struct FCachedCost
+	{
+		float Length = 0.f;
+		double Time = 0.0;
+		bool bReachable = true;
+	};
+
+	struct FPendingQuery
+	{
+		FTilePairKey Key;
+		FVector From;
+		FVector To;
+	};
+
+	FTilePairKey MakeKey(const FVector& From, const FVector& To) const;
+	void OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+
+	UFUNCTION()
+	void OnNavigationGenerationFinished(ANavigationData* NavData);
+
+	TMap<FTilePairKey, FCachedCost> Cache;
+	TArray<FPendingQuery> PendingQueue;
+	TSet<FTilePairKey> Queued;
+	TMap<uint32, FTilePairKey> InFlight;
+};
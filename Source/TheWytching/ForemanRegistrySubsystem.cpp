@@ -0,0 +1,349 @@
+#include "ForemanRegistrySubsystem.h"
+
+#include "ForemanTypes.h"
+#include "Foreman_AIController.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+UForemanRegistrySubsystem* UForemanRegistrySubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UForemanRegistrySubsystem>() : nullptr;
+}
+
+bool UForemanRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UForemanRegistrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (RebalanceInterval > 0.f)
+	{
+		InWorld.GetTimerManager().SetTimer(
+			RebalanceTimerHandle,
+			this,
+			&UForemanRegistrySubsystem::Rebalance,
+			RebalanceInterval,
+			/*bLoop=*/true);
+	}
+}
+
+void UForemanRegistrySubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(RebalanceTimerHandle);
+	}
+
+	Foremen.Reset();
+	WorkerOwners.Reset();
+	PendingWorkers.Reset();
+	StolenWorkers.Reset();
+
+	Super::Deinitialize();
+}
+
+// ─────────────────────────────────────────────────────────
+// Foremen
+// ─────────────────────────────────────────────────────────
+
+void UForemanRegistrySubsystem::RegisterForeman(AForeman_AIController* Foreman)
+{
+	if (!Foreman || Foremen.Contains(Foreman))
+	{
+		return;
+	}
+
+	Foremen.Add(Foreman);
+	UE_LOG(LogForeman, Log, TEXT("ForemanRegistry: %s registered — %d Foremen"),
+		*Foreman->GetName(), Foremen.Num());
+
+	AssignPendingWorkers();
+}
+
+void UForemanRegistrySubsystem::UnregisterForeman(AForeman_AIController* Foreman)
+{
+	if (!Foreman || Foremen.Remove(Foreman) == 0)
+	{
+		return;
+	}
+
+	// Copy — MoveWorker edits the Foreman's roster
+	const TArray<TWeakObjectPtr<AActor>> Workers = Foreman->GetRegisteredWorkers();
+	for (const TWeakObjectPtr<AActor>& WeakWorker : Workers)
+	{
+		AActor* Worker = WeakWorker.Get();
+		if (!Worker) continue;
+
+		if (AForeman_AIController* Heir = FindForemanFor(Worker->GetActorLocation(), Foreman))
+		{
+			MoveWorker(Worker, Heir);
+		}
+		else
+		{
+			Foreman->UnregisterWorker(Worker);
+			PendingWorkers.AddUnique(Worker);
+		}
+	}
+
+	UE_LOG(LogForeman, Log, TEXT("ForemanRegistry: %s unregistered — %d Foremen, %d workers pending"),
+		*Foreman->GetName(), Foremen.Num(), PendingWorkers.Num());
+}
+
+AForeman_AIController* UForemanRegistrySubsystem::FindForemanFor(const FVector& Location,
+	const AForeman_AIController* Exclude) const
+{
+	AForeman_AIController* BestOwner = nullptr;
+	AForeman_AIController* BestAny = nullptr;
+	double BestOwnerDistSq = TNumericLimits<double>::Max();
+	double BestAnyDistSq = TNumericLimits<double>::Max();
+
+	for (const TWeakObjectPtr<AForeman_AIController>& WeakForeman : Foremen)
+	{
+		AForeman_AIController* Foreman = WeakForeman.Get();
+		if (!Foreman || Foreman == Exclude || !Foreman->GetPawn()) continue;
+
+		const double DistSq = FVector::DistSquared(Location, Foreman->GetPawn()->GetActorLocation());
+		if (DistSq < BestAnyDistSq)
+		{
+			BestAnyDistSq = DistSq;
+			BestAny = Foreman;
+		}
+		if (DistSq < BestOwnerDistSq && Foreman->IsInWorkZone(Location))
+		{
+			BestOwnerDistSq = DistSq;
+			BestOwner = Foreman;
+		}
+	}
+
+	return BestOwner ? BestOwner : BestAny;
+}
+
+// ─────────────────────────────────────────────────────────
+// Workers
+// ─────────────────────────────────────────────────────────
+
+void UForemanRegistrySubsystem::AssignWorker(AActor* Worker)
+{
+	if (!Worker) return;
+
+	AForeman_AIController* Foreman = FindForemanFor(Worker->GetActorLocation());
+	if (!Foreman)
+	{
+		// No Foreman (with a pawn) yet — adopt on RegisterForeman / next rebalance
+		PendingWorkers.AddUnique(Worker);
+		UE_LOG(LogForeman, Log, TEXT("ForemanRegistry: no Foreman for %s yet — pending"), *Worker->GetName());
+		return;
+	}
+
+	MoveWorker(Worker, Foreman);
+}
+
+void UForemanRegistrySubsystem::RemoveWorker(AActor* Worker)
+{
+	PendingWorkers.Remove(Worker);
+	StolenWorkers.Remove(Worker);
+	if (AForeman_AIController* Owner = GetOwningForeman(Worker))
+	{
+		Owner->UnregisterWorker(Worker);
+	}
+	WorkerOwners.Remove(Worker);
+}
+
+void UForemanRegistrySubsystem::NotifyWorkerRegistered(AActor* Worker, AForeman_AIController* Foreman)
+{
+	TWeakObjectPtr<AForeman_AIController>& Owner = WorkerOwners.FindOrAdd(Worker);
+	AForeman_AIController* Previous = Owner.Get();
+	Owner = Foreman;
+	PendingWorkers.Remove(Worker);
+
+	// One Foreman per worker — covers Blueprint calls to RegisterWorker too
+	if (Previous && Previous != Foreman)
+	{
+		Previous->UnregisterWorker(Worker);
+	}
+}
+
+void UForemanRegistrySubsystem::NotifyWorkerUnregistered(AActor* Worker, AForeman_AIController* Foreman)
+{
+	const TWeakObjectPtr<AForeman_AIController>* Owner = WorkerOwners.Find(Worker);
+	if (Owner && Owner->Get() == Foreman)
+	{
+		WorkerOwners.Remove(Worker);
+	}
+}
+
+AForeman_AIController* UForemanRegistrySubsystem::GetOwningForeman(AActor* Worker) const
+{
+	const TWeakObjectPtr<AForeman_AIController>* Owner = WorkerOwners.Find(Worker);
+	return Owner ? Owner->Get() : nullptr;
+}
+
+void UForemanRegistrySubsystem::MoveWorker(AActor* Worker, AForeman_AIController* To)
+{
+	// RegisterWorker → NotifyWorkerRegistered unregisters from the previous owner
+	To->RegisterWorker(Worker);
+}
+
+void UForemanRegistrySubsystem::AssignPendingWorkers()
+{
+	if (PendingWorkers.IsEmpty()) return;
+
+	const TArray<TWeakObjectPtr<AActor>> Pending = MoveTemp(PendingWorkers);
+	PendingWorkers.Reset();
+
+	for (const TWeakObjectPtr<AActor>& Worker : Pending)
+	{
+		if (AActor* Resolved = Worker.Get())
+		{
+			AssignWorker(Resolved);
+		}
+	}
+}
+
+// ─────────────────────────────────────────────────────────
+// Rebalancing
+// ─────────────────────────────────────────────────────────
+
+void UForemanRegistrySubsystem::Rebalance()
+{
+	Foremen.RemoveAll([](const TWeakObjectPtr<AForeman_AIController>& Foreman) { return !Foreman.IsValid(); });
+
+	// Foremen whose pawn was not possessed yet at worker BeginPlay
+	AssignPendingWorkers();
+
+	if (Foremen.Num() < 2) return;
+
+	MigrateIdleWorkersBetweenZones();
+	StealWork();
+}
+
+void UForemanRegistrySubsystem::MigrateIdleWorkersBetweenZones()
+{
+	// A stolen worker stays put until its new Foreman has dispatched it (or it went away)
+	for (auto It = StolenWorkers.CreateIterator(); It; ++It)
+	{
+		AActor* Worker = It->Get();
+		const AForeman_AIController* Owner = Worker ? GetOwningForeman(Worker) : nullptr;
+		if (!Owner || Owner->GetWorkerRoster().GetState(Worker) != EWorkerState::Idle)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TArray<TPair<AActor*, AForeman_AIController*>> Moves;
+
+	for (const TWeakObjectPtr<AForeman_AIController>& WeakForeman : Foremen)
+	{
+		AForeman_AIController* Foreman = WeakForeman.Get();
+		if (!Foreman || !Foreman->GetPawn()) continue;
+
+		for (const TWeakObjectPtr<AActor>& WeakWorker : Foreman->GetWorkerRoster().GetIdleWorkers())
+		{
+			AActor* Worker = WeakWorker.Get();
+			if (!Worker || StolenWorkers.Contains(WeakWorker)) continue;
+
+			const FVector Location = Worker->GetActorLocation();
+			if (Foreman->IsInWorkZone(Location)) continue;
+
+			AForeman_AIController* ZoneOwner = FindForemanFor(Location, Foreman);
+			if (ZoneOwner && ZoneOwner->IsInWorkZone(Location))
+			{
+				Moves.Emplace(Worker, ZoneOwner);
+			}
+		}
+	}
+
+	for (const TPair<AActor*, AForeman_AIController*>& Move : Moves)
+	{
+		UE_LOG(LogForeman, Log, TEXT("ForemanRegistry: %s entered %s's zone — migrating"),
+			*Move.Key->GetName(), *Move.Value->GetName());
+		MoveWorker(Move.Key, Move.Value);
+	}
+}
+
+void UForemanRegistrySubsystem::StealWork()
+{
+	struct FLoad
+	{
+		AForeman_AIController* Foreman;
+		FVector Location;
+		int32 Balance;  // idle workers − free slots; > 0 surplus, < 0 deficit
+	};
+
+	TArray<FLoad> Loads;
+	for (const TWeakObjectPtr<AForeman_AIController>& WeakForeman : Foremen)
+	{
+		AForeman_AIController* Foreman = WeakForeman.Get();
+		if (!Foreman || !Foreman->GetPawn()) continue;
+
+		Loads.Add({
+			Foreman,
+			Foreman->GetPawn()->GetActorLocation(),
+			Foreman->GetWorkerRoster().GetNumIdle() - Foreman->GetWorkSnapshot().FreeSlots.Num() });
+	}
+
+	const double StealRadiusSq = FMath::Square((double)StealRadius);
+
+	for (FLoad& Donor : Loads)
+	{
+		if (Donor.Balance <= 0) continue;
+
+		// Nearest short-handed neighbours first
+		TArray<FLoad*> Receivers;
+		for (FLoad& Other : Loads)
+		{
+			if (&Other != &Donor && Other.Balance < 0 &&
+				FVector::DistSquared(Donor.Location, Other.Location) <= StealRadiusSq)
+			{
+				Receivers.Add(&Other);
+			}
+		}
+		Receivers.Sort([&Donor](const FLoad& A, const FLoad& B)
+		{
+			return FVector::DistSquared(Donor.Location, A.Location) < FVector::DistSquared(Donor.Location, B.Location);
+		});
+
+		for (FLoad* Receiver : Receivers)
+		{
+			const int32 Count = FMath::Min3(Donor.Balance, -Receiver->Balance, MaxTransfersPerPass);
+			if (Count <= 0) break;
+
+			// Hand over the donor's idle workers closest to the receiver
+			TArray<AActor*> Idle;
+			for (const TWeakObjectPtr<AActor>& WeakWorker : Donor.Foreman->GetWorkerRoster().GetIdleWorkers())
+			{
+				if (AActor* Worker = WeakWorker.Get())
+				{
+					Idle.Add(Worker);
+				}
+			}
+			Idle.Sort([Receiver](const AActor& A, const AActor& B)
+			{
+				return FVector::DistSquared(A.GetActorLocation(), Receiver->Location) <
+					FVector::DistSquared(B.GetActorLocation(), Receiver->Location);
+			});
+
+			const int32 Moved = FMath::Min(Count, Idle.Num());
+			for (int32 Index = 0; Index < Moved; ++Index)
+			{
+				MoveWorker(Idle[Index], Receiver->Foreman);
+				StolenWorkers.Add(Idle[Index]);
+			}
+
+			Donor.Balance -= Moved;
+			Receiver->Balance += Moved;
+
+			if (Moved > 0)
+			{
+				UE_LOG(LogForeman, Log, TEXT("ForemanRegistry: %s handed %d idle worker(s) to %s"),
+					*Donor.Foreman->GetName(), Moved, *Receiver->Foreman->GetName());
+			}
+
+			if (Donor.Balance <= 0) break;
+		}
+	}
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ForemanRegistrySubsystem.generated.h"
+
+class AForeman_AIController;
+
+/**
+ * Shards workers across every Foreman in the world.
+ *
+ * Workers are registered with the Foreman whose work zone contains them
+ * (nearest zone owner), or the nearest Foreman if none does. Workers that
+ * spawn before any Foreman are held and handed out as Foremen come online.
+ *
+ * Every RebalanceInterval:
+ *   1. Zone migration — idle workers standing in another Foreman's zone
+ *      and outside their own move to that Foreman.
+ *   2. Work stealing — a Foreman with more idle workers than free slots
+ *      hands the surplus to the nearest neighbours (within StealRadius)
+ *      that have more free slots than idle workers.
+ * Only idle workers move; in-flight assignments stay with their Foreman.
+ * A stolen worker is exempt from zone migration until it leaves Idle, so
+ * step 1 does not hand it straight back to the donor whose zone it stands in.
+ */
+UCLASS(Config = Game)
+class THEWYTCHING_API UForemanRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UForemanRegistrySubsystem* Get(const UWorld* World);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	void RegisterForeman(AForeman_AIController* Foreman);
+
+	/** Hands the Foreman's workers to the remaining Foremen. */
+	void UnregisterForeman(AForeman_AIController* Foreman);
+
+	/** Registers Worker with the best Foreman for its location (or holds it until one exists). */
+	void AssignWorker(AActor* Worker);
+
+	/** Drops the worker from its Foreman and from the pending list. */
+	void RemoveWorker(AActor* Worker);
+
+	/** Ownership bookkeeping — called by AForeman_AIController::Register/UnregisterWorker. */
+	void NotifyWorkerRegistered(AActor* Worker, AForeman_AIController* Foreman);
+	void NotifyWorkerUnregistered(AActor* Worker, AForeman_AIController* Foreman);
+
+	AForeman_AIController* GetOwningForeman(AActor* Worker) const;
+
+	/** Zone owner containing Location, else the nearest Foreman. Ignores Foremen without a pawn. */
+	AForeman_AIController* FindForemanFor(const FVector& Location, const AForeman_AIController* Exclude = nullptr) const;
+
+	void Rebalance();
+
+	/** Seconds between rebalance passes. 0 = never rebalance. */
+	UPROPERTY(Config)
+	float RebalanceInterval = 2.f;
+
+	/** Max distance between Foremen for work stealing. */
+	UPROPERTY(Config)
+	float StealRadius = 20000.f;
+
+	/** Cap on workers moved per Foreman pair per pass — keeps handoffs gradual. */
+	UPROPERTY(Config)
+	int32 MaxTransfersPerPass = 4;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void MoveWorker(AActor* Worker, AForeman_AIController* To);
+	void MigrateIdleWorkersBetweenZones();
+	void StealWork();
+	void AssignPendingWorkers();
+
+	TArray<TWeakObjectPtr<AForeman_AIController>> Foremen;
+	TMap<TWeakObjectPtr<AActor>, TWeakObjectPtr<AForeman_AIController>> WorkerOwners;
+
+	/** Workers that registered before any Foreman existed. */
+	TArray<TWeakObjectPtr<AActor>> PendingWorkers;
+
+	/** Workers handed over by StealWork that have not left Idle since. */
+	TSet<TWeakObjectPtr<AActor>> StolenWorkers;
+
+	FTimerHandle RebalanceTimerHandle;
+};
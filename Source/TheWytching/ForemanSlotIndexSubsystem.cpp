@@ -0,0 +1,499 @@
+#include "ForemanSlotIndexSubsystem.h"
+
+#include "ForemanTypes.h"
+#include "WytchCapabilityMask.h"
+#include "SmartObjectSubsystem.h"
+#include "SmartObjectComponent.h"
+#include "SmartObjectDefinition.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "UObject/UObjectIterator.h"
+
+namespace
+{
+	/** Task.* / Capability.* tags a slot asks for — the part a worker must cover. */
+	FGameplayTagContainer GatherSlotRequirements(const USmartObjectSubsystem& SOSubsystem,
+		const FSmartObjectRequestResult& Result)
+	{
+		FGameplayTagContainer SlotTags;
+
+		if (const USmartObjectComponent* SOComponent = SOSubsystem.GetSmartObjectComponentByRequestResult(Result))
+		{
+			if (const USmartObjectDefinition* Definition = SOComponent->GetDefinition())
+			{
+				SlotTags.AppendTags(Definition->GetActivityTags());
+			}
+		}
+
+		const FSmartObjectSlotView SlotView = SOSubsystem.GetSlotView(Result.SlotHandle);
+		if (SlotView.IsValid())
+		{
+			SlotTags.AppendTags(SlotView.GetDefinition().ActivityTags);
+		}
+
+		return FWytchCapabilityRegistry::Get().FilterDispatchTags(SlotTags);
+	}
+}
+
+UForemanSlotIndexSubsystem* UForemanSlotIndexSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UForemanSlotIndexSubsystem>() : nullptr;
+}
+
+bool UForemanSlotIndexSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UForemanSlotIndexSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// SmartObject components register during actor BeginPlay, which has run by now
+	RefreshDiscovery();
+
+	ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(
+		FOnActorSpawned::FDelegate::CreateUObject(this, &UForemanSlotIndexSubsystem::OnActorSpawned));
+	ActorDestroyedHandle = InWorld.AddOnActorDestroyededHandler(
+		FOnActorDestroyed::FDelegate::CreateUObject(this, &UForemanSlotIndexSubsystem::OnActorDestroyed));
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UForemanSlotIndexSubsystem::OnLevelAdded);
+	LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddUObject(this, &UForemanSlotIndexSubsystem::OnLevelRemoved);
+}
+
+void UForemanSlotIndexSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PendingTimerHandle);
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+	}
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::LevelRemovedFromWorld.Remove(LevelRemovedHandle);
+
+	TArray<FSmartObjectHandle> ObjectHandles;
+	Objects.GetKeys(ObjectHandles);
+	for (const FSmartObjectHandle& ObjectHandle : ObjectHandles)
+	{
+		UnregisterObject(ObjectHandle);
+	}
+	ObjectsByActor.Reset();
+	PendingActors.Reset();
+
+	Super::Deinitialize();
+}
+
+// ─────────────────────────────────────────────────────────
+// Discovery — actor spawn / destroy and level streaming
+// ─────────────────────────────────────────────────────────
+
+void UForemanSlotIndexSubsystem::RefreshDiscovery()
+{
+	USmartObjectSubsystem* SOSubsystem = USmartObjectSubsystem::GetCurrent(GetWorld());
+	if (!SOSubsystem)
+	{
+		return;
+	}
+
+	// Drop objects unregistered behind our back (component removed without its actor)
+	TArray<FSmartObjectHandle> Stale;
+	for (const TPair<FSmartObjectHandle, FIndexedObject>& Pair : Objects)
+	{
+		if (!SOSubsystem->IsSmartObjectValid(Pair.Key))
+		{
+			Stale.Add(Pair.Key);
+		}
+	}
+	for (const FSmartObjectHandle& ObjectHandle : Stale)
+	{
+		UnregisterObject(ObjectHandle);
+	}
+
+	const int32 NumObjectsBefore = Objects.Num();
+	for (TObjectIterator<USmartObjectComponent> It; It; ++It)
+	{
+		AActor* Owner = It->GetOwner();
+		if (Owner && It->GetWorld() == GetWorld())
+		{
+			RegisterActor(*SOSubsystem, *Owner);
+		}
+	}
+
+	UE_LOG(LogForeman, Log,
+		TEXT("SlotIndex: +%d / -%d objects — %d slots tracked, %d free"),
+		Objects.Num() - NumObjectsBefore, Stale.Num(), Slots.Num(), NumFreeSlots);
+}
+
+void UForemanSlotIndexSubsystem::OnActorSpawned(AActor* Actor)
+{
+	if (!Actor || !Actor->FindComponentByClass<USmartObjectComponent>())
+	{
+		return;
+	}
+
+	// Deferred spawns have not run BeginPlay yet — index once the frame is over
+	PendingActors.Add(Actor);
+	if (!PendingTimerHandle.IsValid())
+	{
+		PendingTimerHandle = GetWorld()->GetTimerManager().SetTimerForNextTick(
+			this, &UForemanSlotIndexSubsystem::RegisterPendingActors);
+	}
+}
+
+void UForemanSlotIndexSubsystem::RegisterPendingActors()
+{
+	PendingTimerHandle.Invalidate();
+
+	USmartObjectSubsystem* SOSubsystem = USmartObjectSubsystem::GetCurrent(GetWorld());
+	const TArray<TWeakObjectPtr<AActor>> Pending = MoveTemp(PendingActors);
+	PendingActors.Reset();
+	if (!SOSubsystem)
+	{
+		return;
+	}
+
+	for (const TWeakObjectPtr<AActor>& Actor : Pending)
+	{
+		if (AActor* Resolved = Actor.Get())
+		{
+			RegisterActor(*SOSubsystem, *Resolved);
+		}
+	}
+}
+
+void UForemanSlotIndexSubsystem::OnActorDestroyed(AActor* Actor)
+{
+	if (Actor)
+	{
+		UnregisterActor(*Actor);
+	}
+}
+
+void UForemanSlotIndexSubsystem::OnLevelAdded(ULevel* Level, UWorld* World)
+{
+	if (!Level || World != GetWorld())
+	{
+		return;
+	}
+
+	// Streamed-in actors don't go through SpawnActor
+	for (AActor* Actor : Level->Actors)
+	{
+		OnActorSpawned(Actor);
+	}
+}
+
+void UForemanSlotIndexSubsystem::OnLevelRemoved(ULevel* Level, UWorld* World)
+{
+	if (!Level || World != GetWorld())
+	{
+		return;
+	}
+
+	for (const AActor* Actor : Level->Actors)
+	{
+		if (Actor)
+		{
+			UnregisterActor(*Actor);
+		}
+	}
+}
+
+void UForemanSlotIndexSubsystem::RegisterActor(USmartObjectSubsystem& SOSubsystem, AActor& Actor)
+{
+	TInlineComponentArray<USmartObjectComponent*> Components(&Actor);
+	for (const USmartObjectComponent* Component : Components)
+	{
+		const FSmartObjectHandle ObjectHandle = Component->GetRegisteredHandle();
+		if (ObjectHandle.IsValid() && !Objects.Contains(ObjectHandle))
+		{
+			RegisterObject(SOSubsystem, ObjectHandle, Actor);
+		}
+	}
+}
+
+void UForemanSlotIndexSubsystem::UnregisterActor(const AActor& Actor)
+{
+	TArray<FSmartObjectHandle> ObjectHandles;
+	ObjectsByActor.MultiFind(&Actor, ObjectHandles);
+	ObjectsByActor.Remove(&Actor);
+
+	for (const FSmartObjectHandle& ObjectHandle : ObjectHandles)
+	{
+		UnregisterObject(ObjectHandle);
+	}
+}
+
+void UForemanSlotIndexSubsystem::RegisterObject(USmartObjectSubsystem& SOSubsystem, FSmartObjectHandle ObjectHandle,
+	AActor& Owner)
+{
+	FIndexedObject& Object = Objects.Add(ObjectHandle);
+	ObjectsByActor.Add(&Owner, ObjectHandle);
+	SOSubsystem.GetAllSlots(ObjectHandle, Object.SlotHandles);
+
+	if (FOnSmartObjectEvent* EventDelegate = SOSubsystem.GetEventDelegate(ObjectHandle))
+	{
+		Object.EventHandle = EventDelegate->AddUObject(this, &UForemanSlotIndexSubsystem::OnSmartObjectEvent);
+	}
+
+	for (const FSmartObjectSlotHandle& SlotHandle : Object.SlotHandles)
+	{
+		FForemanIndexedSlot& Slot = Slots.Add(SlotHandle);
+		Slot.ObjectHandle = ObjectHandle;
+		Slot.SlotHandle = SlotHandle;
+		Slot.Requirements = GatherSlotRequirements(SOSubsystem, Slot.ToRequestResult());
+		Slot.RequirementMask = FWytchCapabilityRegistry::Get().MakeRequirementMask(Slot.Requirements);
+		Slot.Owner = &Owner;
+
+		if (TOptional<FTransform> SlotTransform = SOSubsystem.GetSlotTransform(Slot.ToRequestResult()))
+		{
+			Slot.Location = SlotTransform.GetValue().GetLocation();
+		}
+		Slot.Cell = GetCell(Slot.Location);
+
+		RefreshSlot(SOSubsystem, Slot);
+	}
+}
+
+void UForemanSlotIndexSubsystem::UnregisterObject(FSmartObjectHandle ObjectHandle)
+{
+	FIndexedObject Object;
+	if (!Objects.RemoveAndCopyValue(ObjectHandle, Object))
+	{
+		return;
+	}
+
+	if (Object.EventHandle.IsValid())
+	{
+		if (USmartObjectSubsystem* SOSubsystem = USmartObjectSubsystem::GetCurrent(GetWorld()))
+		{
+			if (FOnSmartObjectEvent* EventDelegate = SOSubsystem->GetEventDelegate(ObjectHandle))
+			{
+				EventDelegate->Remove(Object.EventHandle);
+			}
+		}
+	}
+
+	for (const FSmartObjectSlotHandle& SlotHandle : Object.SlotHandles)
+	{
+		if (FForemanIndexedSlot* Slot = Slots.Find(SlotHandle))
+		{
+			SetSlotFree(*Slot, false);
+			Slots.Remove(SlotHandle);
+		}
+	}
+}
+
+// ─────────────────────────────────────────────────────────
+// Event-driven state
+// ─────────────────────────────────────────────────────────
+
+void UForemanSlotIndexSubsystem::OnSmartObjectEvent(const FSmartObjectEventData& Event)
+{
+	USmartObjectSubsystem* SOSubsystem = USmartObjectSubsystem::GetCurrent(GetWorld());
+	if (!SOSubsystem)
+	{
+		return;
+	}
+
+	// Slot events (claim/occupy/release, slot enable) touch one slot;
+	// object events (object enable/disable) touch all of them.
+	if (Event.SlotHandle.IsValid())
+	{
+		if (FForemanIndexedSlot* Slot = Slots.Find(Event.SlotHandle))
+		{
+			RefreshSlot(*SOSubsystem, *Slot);
+		}
+		return;
+	}
+
+	if (const FIndexedObject* Object = Objects.Find(Event.SmartObjectHandle))
+	{
+		for (const FSmartObjectSlotHandle& SlotHandle : Object->SlotHandles)
+		{
+			if (FForemanIndexedSlot* Slot = Slots.Find(SlotHandle))
+			{
+				RefreshSlot(*SOSubsystem, *Slot);
+			}
+		}
+	}
+}
+
+void UForemanSlotIndexSubsystem::ReserveSlot(FSmartObjectSlotHandle SlotHandle)
+{
+	if (FForemanIndexedSlot* Slot = Slots.Find(SlotHandle))
+	{
+		Slot->bReserved = true;
+		SetSlotFree(*Slot, false);
+	}
+}
+
+void UForemanSlotIndexSubsystem::UnreserveSlot(FSmartObjectSlotHandle SlotHandle)
+{
+	FForemanIndexedSlot* Slot = Slots.Find(SlotHandle);
+	if (!Slot || !Slot->bReserved) return;
+
+	Slot->bReserved = false;
+	if (USmartObjectSubsystem* SOSubsystem = USmartObjectSubsystem::GetCurrent(GetWorld()))
+	{
+		RefreshSlot(*SOSubsystem, *Slot);
+	}
+}
+
+void UForemanSlotIndexSubsystem::RefreshSlot(USmartObjectSubsystem& SOSubsystem, FForemanIndexedSlot& Slot)
+{
+	const bool bFree = !Slot.bReserved && SOSubsystem.IsEnabled(Slot.ObjectHandle) &&
+		SOSubsystem.GetSlotState(Slot.SlotHandle) == ESmartObjectSlotState::Free;
+	SetSlotFree(Slot, bFree);
+}
+
+void UForemanSlotIndexSubsystem::SetSlotFree(FForemanIndexedSlot& Slot, bool bFree)
+{
+	if (Slot.bFree == bFree)
+	{
+		return;
+	}
+	Slot.bFree = bFree;
+
+	const int32 Delta = bFree ? 1 : -1;
+	NumFreeSlots += Delta;
+
+	auto UpdateBucket = [this, &Slot, bFree, Delta](const FGameplayTag& Tag)
+	{
+		TMap<FIntPoint, TSet<FSmartObjectSlotHandle>>& Cells = FreeByActivity.FindOrAdd(Tag);
+		if (bFree)
+		{
+			Cells.FindOrAdd(Slot.Cell).Add(Slot.SlotHandle);
+		}
+		else if (TSet<FSmartObjectSlotHandle>* Bucket = Cells.Find(Slot.Cell))
+		{
+			Bucket->Remove(Slot.SlotHandle);
+			if (Bucket->IsEmpty())
+			{
+				Cells.Remove(Slot.Cell);
+			}
+		}
+		FreeCountByActivity.FindOrAdd(Tag) += Delta;
+	};
+
+	UpdateBucket(FGameplayTag());
+	for (const FGameplayTag& Tag : Slot.Requirements)
+	{
+		UpdateBucket(Tag);
+	}
+
+	if (bFree)
+	{
+		OnSlotFreed.Broadcast(Slot);
+	}
+}
+
+// ─────────────────────────────────────────────────────────
+// Queries
+// ─────────────────────────────────────────────────────────
+
+FIntPoint UForemanSlotIndexSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt32(Location.X / CellSize),
+		FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+int32 UForemanSlotIndexSubsystem::GetNumFreeSlots(FGameplayTag ActivityTag) const
+{
+	const int32* Count = FreeCountByActivity.Find(ActivityTag);
+	return Count ? *Count : 0;
+}
+
+template <typename FunctorType>
+void UForemanSlotIndexSubsystem::ForEachFreeSlotInBox(const FBox& Box, FGameplayTag ActivityTag, FunctorType&& Functor) const
+{
+	const TMap<FIntPoint, TSet<FSmartObjectSlotHandle>>* Cells = FreeByActivity.Find(ActivityTag);
+	if (!Cells || Cells->IsEmpty())
+	{
+		return;
+	}
+
+	const FIntPoint MinCell = GetCell(Box.Min);
+	const FIntPoint MaxCell = GetCell(Box.Max);
+	const int64 NumCellsInBox = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+	// Returns false to stop iterating
+	auto VisitBucket = [this, &Box, &Functor](const TSet<FSmartObjectSlotHandle>& Bucket)
+	{
+		for (const FSmartObjectSlotHandle& SlotHandle : Bucket)
+		{
+			const FForemanIndexedSlot& Slot = Slots.FindChecked(SlotHandle);
+			if (Box.IsInsideOrOn(Slot.Location) && !Functor(Slot))
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+
+	// Walk whichever is smaller: the cells under the box, or the occupied cells
+	if (NumCellsInBox <= Cells->Num())
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				const TSet<FSmartObjectSlotHandle>* Bucket = Cells->Find(FIntPoint(X, Y));
+				if (Bucket && !VisitBucket(*Bucket))
+				{
+					return;
+				}
+			}
+		}
+	}
+	else
+	{
+		for (const TPair<FIntPoint, TSet<FSmartObjectSlotHandle>>& Pair : *Cells)
+		{
+			if (Pair.Key.X < MinCell.X || Pair.Key.X > MaxCell.X ||
+				Pair.Key.Y < MinCell.Y || Pair.Key.Y > MaxCell.Y)
+			{
+				continue;
+			}
+			if (!VisitBucket(Pair.Value))
+			{
+				return;
+			}
+		}
+	}
+}
+
+int32 UForemanSlotIndexSubsystem::CountFreeSlots(const FBox& Box, FGameplayTag ActivityTag) const
+{
+	int32 Count = 0;
+	ForEachFreeSlotInBox(Box, ActivityTag, [&Count](const FForemanIndexedSlot&)
+	{
+		++Count;
+		return true;
+	});
+	return Count;
+}
+
+bool UForemanSlotIndexSubsystem::HasFreeSlot(const FBox& Box, FGameplayTag ActivityTag) const
+{
+	bool bFound = false;
+	ForEachFreeSlotInBox(Box, ActivityTag, [&bFound](const FForemanIndexedSlot&)
+	{
+		bFound = true;
+		return false;
+	});
+	return bFound;
+}
+
+void UForemanSlotIndexSubsystem::GetFreeSlots(const FBox& Box, TArray<const FForemanIndexedSlot*>& OutSlots,
+	FGameplayTag ActivityTag) const
+{
+	OutSlots.Reset();
+	ForEachFreeSlotInBox(Box, ActivityTag, [&OutSlots](const FForemanIndexedSlot& Slot)
+	{
+		OutSlots.Add(&Slot);
+		return true;
+	});
+}
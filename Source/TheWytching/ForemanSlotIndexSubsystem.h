@@ -0,0 +1,174 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "WytchCapabilityMask.h"
+#include "SmartObjectRuntime.h"
+#include "SmartObjectRequestTypes.h"
+#include "ForemanSlotIndexSubsystem.generated.h"
+
+class AActor;
+class ULevel;
+class USmartObjectSubsystem;
+struct FSmartObjectEventData;
+struct FForemanIndexedSlot;
+
+/** A slot became free (released, re-enabled or newly discovered). */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnForemanSlotFreed, const FForemanIndexedSlot& /*Slot*/);
+
+// ─────────────────────────────────────────────────────────
+// FForemanIndexedSlot — cached view of one SmartObject slot
+// ─────────────────────────────────────────────────────────
+struct FForemanIndexedSlot
+{
+	FSmartObjectHandle ObjectHandle;
+	FSmartObjectSlotHandle SlotHandle;
+
+	/** Slot world location, captured at registration. */
+	FVector Location = FVector::ZeroVector;
+
+	/** Task.* / Capability.* tags from the object + slot definitions — what a worker must cover. */
+	FGameplayTagContainer Requirements;
+
+	/** Requirements as capability bits (Task.* mapped via UWytchCapabilitySettings) — match with WorkerMask.Covers(RequirementMask). */
+	FWytchCapabilityMask RequirementMask;
+
+	/** Actor owning the SmartObjectComponent (the IWytchWorkSite target). */
+	TWeakObjectPtr<AActor> Owner;
+
+	FIntPoint Cell = FIntPoint::ZeroValue;
+	bool bFree = false;
+
+	/** Held for a worker's follow-up job — counted as taken until unreserved. */
+	bool bReserved = false;
+
+	FSmartObjectRequestResult ToRequestResult() const
+	{
+		return FSmartObjectRequestResult(ObjectHandle, SlotHandle);
+	}
+};
+
+/**
+ * Incremental index of free SmartObject slots, keyed by activity tag and
+ * grid region. Slot state follows SmartObject claim/release/enable events,
+ * so Foreman conditions, evaluators and PlanJob read it without running
+ * FindSmartObjects + GetSlotState each evaluation.
+ *
+ * Objects are indexed when their actor spawns or streams in and dropped
+ * when it is destroyed or streams out — no periodic sweep. A spawned
+ * object is indexed on the next tick (once its component has registered
+ * with the SmartObject subsystem), so it is missing from the counts for
+ * that one frame.
+ */
+UCLASS(Config = Game)
+class THEWYTCHING_API UForemanSlotIndexSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UForemanSlotIndexSubsystem* Get(const UWorld* World);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Total free slots in the world. O(1). */
+	int32 GetNumFreeSlots() const { return NumFreeSlots; }
+
+	/** Free slots carrying ActivityTag (exact match). O(1). */
+	int32 GetNumFreeSlots(FGameplayTag ActivityTag) const;
+
+	/**
+	 * Free slots inside Box, optionally filtered by activity tag. Visits the
+	 * cells under Box (or the occupied cells, if fewer) and every free slot in
+	 * them — cost grows with the box and the free slots it holds, not O(1).
+	 */
+	int32 CountFreeSlots(const FBox& Box, FGameplayTag ActivityTag = FGameplayTag()) const;
+
+	/** True if at least one free slot lies inside Box. Same cell walk as CountFreeSlots, stopping at the first hit. */
+	bool HasFreeSlot(const FBox& Box, FGameplayTag ActivityTag = FGameplayTag()) const;
+
+	/**
+	 * Collects free slots inside Box. Pointers stay valid until the index
+	 * next changes (slot event or discovery sweep) — use them immediately.
+	 */
+	void GetFreeSlots(const FBox& Box, TArray<const FForemanIndexedSlot*>& OutSlots,
+		FGameplayTag ActivityTag = FGameplayTag()) const;
+
+	const FForemanIndexedSlot* FindSlot(FSmartObjectSlotHandle SlotHandle) const { return Slots.Find(SlotHandle); }
+
+	/**
+	 * Holds a slot for a follow-up job the worker has not claimed yet. The
+	 * slot reads as taken for every query (and every Foreman) until
+	 * UnreserveSlot, even if SmartObjects still reports it Free.
+	 */
+	void ReserveSlot(FSmartObjectSlotHandle SlotHandle);
+
+	/** Drops a reservation; the slot is free again unless it has since been claimed. */
+	void UnreserveSlot(FSmartObjectSlotHandle SlotHandle);
+
+	/** Re-scans every SmartObject component in the world. Spawns and level streaming are picked up without it. */
+	void RefreshDiscovery();
+
+	FOnForemanSlotFreed OnSlotFreed;
+
+	/** Side length of one index region in world units. */
+	UPROPERTY(Config)
+	float CellSize = 2000.f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void RegisterActor(USmartObjectSubsystem& SOSubsystem, AActor& Actor);
+	void UnregisterActor(const AActor& Actor);
+	void RegisterObject(USmartObjectSubsystem& SOSubsystem, FSmartObjectHandle ObjectHandle, AActor& Owner);
+	void UnregisterObject(FSmartObjectHandle ObjectHandle);
+	void OnSmartObjectEvent(const FSmartObjectEventData& Event);
+
+	void OnActorSpawned(AActor* Actor);
+	void OnActorDestroyed(AActor* Actor);
+	void OnLevelAdded(ULevel* Level, UWorld* World);
+	void OnLevelRemoved(ULevel* Level, UWorld* World);
+
+	/** Indexes actors spawned since the last tick — their components have registered by now. */
+	void RegisterPendingActors();
+
+	/** Sets a slot's free flag and keeps the bucket/counter bookkeeping in step. */
+	void SetSlotFree(FForemanIndexedSlot& Slot, bool bFree);
+
+	/** Re-reads a slot's state from the SmartObject subsystem. */
+	void RefreshSlot(USmartObjectSubsystem& SOSubsystem, FForemanIndexedSlot& Slot);
+
+	FIntPoint GetCell(const FVector& Location) const;
+
+	template <typename FunctorType>
+	void ForEachFreeSlotInBox(const FBox& Box, FGameplayTag ActivityTag, FunctorType&& Functor) const;
+
+	TMap<FSmartObjectSlotHandle, FForemanIndexedSlot> Slots;
+
+	/** Per-object slot list + event subscription. */
+	struct FIndexedObject
+	{
+		TArray<FSmartObjectSlotHandle> SlotHandles;
+		FDelegateHandle EventHandle;
+	};
+	TMap<FSmartObjectHandle, FIndexedObject> Objects;
+
+	/** Objects per owning actor — how destroy/stream-out events find what to drop. */
+	TMultiMap<TWeakObjectPtr<const AActor>, FSmartObjectHandle> ObjectsByActor;
+
+	/** Free slots per activity tag per cell. The empty tag bucket holds every free slot. */
+	TMap<FGameplayTag, TMap<FIntPoint, TSet<FSmartObjectSlotHandle>>> FreeByActivity;
+
+	TMap<FGameplayTag, int32> FreeCountByActivity;
+	int32 NumFreeSlots = 0;
+
+	TArray<TWeakObjectPtr<AActor>> PendingActors;
+	FTimerHandle PendingTimerHandle;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle ActorDestroyedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle LevelRemovedHandle;
+};
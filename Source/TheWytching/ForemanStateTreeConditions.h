@@ -21,7 +21,8 @@ struct FForemanConditionInstanceData
 
 // ─────────────────────────────────────────────────────────
 // FForemanCondition_HasIdleWorkers
-//   True when at least one registered worker is in Idle state.
+//   True when at least one registered worker is in Idle state,
+//   as of the Foreman's latest work snapshot.
 // ─────────────────────────────────────────────────────────
 USTRUCT(meta = (DisplayName = "Foreman: Has Idle Workers"))
 struct THEWYTCHING_API FForemanCondition_HasIdleWorkers : public FStateTreeConditionCommonBase
@@ -40,7 +41,8 @@ struct THEWYTCHING_API FForemanCondition_HasIdleWorkers : public FStateTreeCondi
 
 // ─────────────────────────────────────────────────────────
 // FForemanCondition_HasAvailableWork
-//   True when at least one workstation is available (unclaimed).
+//   True when at least one workstation is available (unclaimed),
+//   as of the Foreman's latest work snapshot.
 // ─────────────────────────────────────────────────────────
 USTRUCT(meta = (DisplayName = "Foreman: Has Available Work"))
 struct THEWYTCHING_API FForemanCondition_HasAvailableWork : public FStateTreeConditionCommonBase
@@ -1,11 +1,10 @@
 #include "ForemanStateTreeEvaluators.h"
 
+#include "WytchEventLog.h"
+#include "WytchingStats.h"
 #include "ForemanTypes.h"
 #include "Foreman_AIController.h"
-#include "IWytchCommandable.h"
-#include "AndroidConditionComponent.h"
-#include "SmartObjectSubsystem.h"
-#include "SmartObjectRequestTypes.h"
+#include "ForemanSlotIndexSubsystem.h"
 #include "GameFramework/Pawn.h"
 
 // ─────────────────────────────────────────────────────────
@@ -35,6 +34,8 @@ void FForemanEval_WorkAvailability::Tick(
 	FStateTreeExecutionContext& Context,
 	const float DeltaTime) const
 {
+	WYTCH_SCOPE(STAT_WytchEvalWorkAvailability);
+
 	FInstanceDataType& Data = Context.GetInstanceData<FInstanceDataType>(*this);
 	Data.TimeSinceLastScan += DeltaTime;
 
@@ -47,6 +48,8 @@ void FForemanEval_WorkAvailability::Tick(
 
 void FForemanEval_WorkAvailability::ScanWorld(FInstanceDataType& Data) const
 {
+	WYTCH_SCOPE(STAT_WytchForemanScan);
+
 	APawn* Pawn = Data.Pawn.Get();
 	if (!Pawn || !Pawn->GetWorld())
 	{
@@ -56,75 +59,41 @@ void FForemanEval_WorkAvailability::ScanWorld(FInstanceDataType& Data) const
 		return;
 	}
 
-	UWorld* World = Pawn->GetWorld();
-
-	// ── 1. Idle worker count via roster + IWytchCommandable::GetWorkerState() ──
-
 	AForeman_AIController* ForemanAIC = Cast<AForeman_AIController>(Pawn->GetController());
-	int32 IdleCount = 0;
-	int32 ActiveCount = 0;
-
-	if (ForemanAIC)
-	{
-		const TArray<TWeakObjectPtr<AActor>>& Roster = ForemanAIC->GetRegisteredWorkers();
-		for (const TWeakObjectPtr<AActor>& WeakWorker : Roster)
-		{
-			AActor* Worker = WeakWorker.Get();
-			if (!Worker) continue;
-
-			if (IWytchCommandable* Commandable = Cast<IWytchCommandable>(Worker))
-			{
-				const EWorkerState State = Commandable->Execute_GetWorkerState(Worker);
-				if (State == EWorkerState::Idle)
-				{
-					++IdleCount;
-				}
-				else if (State == EWorkerState::Working || State == EWorkerState::MovingToTask)
-				{
-					++ActiveCount;
-				}
-			}
-		}
-	}
-	else
+	if (!ForemanAIC)
 	{
-		UE_LOG(LogForeman, Warning,
+		WYTCH_EVENT(Foreman, Warning,
 			TEXT("WorkAvailabilityEval::ScanWorld — Pawn has no AForeman_AIController, idle count will be 0"));
+		Data.IdleWorkerCount = 0;
+		Data.AvailableWorkCount = 0;
+		Data.ActiveAssignmentCount = 0;
+		return;
 	}
 
-	// ── 2. Available work count via SmartObject subsystem ──
+	// One roster copy + one index query per scan. Conditions and PlanJob read the
+	// snapshot until the next scan instead of repeating the work themselves.
+	ForemanAIC->PollUnobservedWorkers();
 
-	int32 AvailableCount = 0;
+	FForemanWorkSnapshot& Snapshot = ForemanAIC->GetMutableWorkSnapshot();
+	Snapshot.Refresh(
+		*ForemanAIC,
+		UForemanSlotIndexSubsystem::Get(Pawn->GetWorld()),
+		ForemanAIC->GetWorkZone());
+	ForemanAIC->SyncJobQueue();
+	ForemanAIC->PreassignFollowUpJobs();
+	ForemanAIC->DispatchMassWorkers();
 
-	if (USmartObjectSubsystem* SOSubsystem = USmartObjectSubsystem::GetCurrent(World))
-	{
-		// GetCurrent() returns null if the subsystem isn't ready — no further guard needed.
-		FSmartObjectRequest Request;
-		// Query sphere centred on the Foreman — 5000 units covers the work zone
-		Request.QueryBox = FBox::BuildAABB(Pawn->GetActorLocation(), FVector(5000.f));
-
-		TArray<FSmartObjectRequestResult> Results;
-		SOSubsystem->FindSmartObjects(Request, Results);
-
-		for (const FSmartObjectRequestResult& Result : Results)
-		{
-			// Only count unclaimed slots — claimed slots belong to active assignments
-			// (already counted above via worker state)
-			const ESmartObjectSlotState SlotState =
-				SOSubsystem->GetSlotState(Result.SlotHandle);
-
-			if (SlotState == ESmartObjectSlotState::Free)
-			{
-				++AvailableCount;
-			}
-		}
-	}
+	const int32 IdleCount = Snapshot.IdleWorkers.Num();
+	const int32 AvailableCount = Snapshot.FreeSlots.Num();
+	const int32 ActiveCount = Snapshot.ActiveWorkers.Num();
 
 	Data.IdleWorkerCount = IdleCount;
 	Data.AvailableWorkCount = AvailableCount;
 	Data.ActiveAssignmentCount = ActiveCount;
+	Data.SnapshotGeneration = (int32)Snapshot.Generation;
+	Data.PendingJobCount = ForemanAIC->GetJobQueue().GetNumPending();
 
-	UE_LOG(LogForeman, Log,
-		TEXT("WorkAvailability scan: idle=%d available=%d active=%d"),
-		IdleCount, AvailableCount, ActiveCount);
+	WYTCH_EVENT(Foreman, Trace,
+		TEXT("WorkAvailability scan: idle=%d available=%d active=%d pending jobs=%d"),
+		IdleCount, AvailableCount, ActiveCount, Data.PendingJobCount);
 }
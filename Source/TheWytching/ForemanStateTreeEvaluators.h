@@ -9,9 +9,10 @@ class APawn;
 
 // ─────────────────────────────────────────────────────────
 // FForemanEval_WorkAvailability
-//   Ticks continuously. Maintains cached counts of idle
-//   workers and available workstations. Exposed as output
-//   properties for conditions and tasks to bind against.
+//   Ticks continuously. Refreshes the Foreman's work snapshot
+//   (idle/active workers, free slots) every ScanInterval and
+//   exposes the counts as output properties. Conditions and
+//   PlanJob read the same snapshot from the AIController.
 // ─────────────────────────────────────────────────────────
 USTRUCT()
 struct FForemanEval_WorkAvailabilityInstanceData
@@ -31,6 +32,14 @@ struct FForemanEval_WorkAvailabilityInstanceData
 	UPROPERTY(EditAnywhere, Category = "Output")
 	int32 ActiveAssignmentCount = 0;
 
+	// Output: generation of the Foreman's work snapshot this scan produced
+	UPROPERTY(EditAnywhere, Category = "Output")
+	int32 SnapshotGeneration = 0;
+
+	// Output: jobs in the Foreman's queue still waiting for a worker
+	UPROPERTY(EditAnywhere, Category = "Output")
+	int32 PendingJobCount = 0;
+
 	// Internal tick throttle
 	float TimeSinceLastScan = 0.f;
 };
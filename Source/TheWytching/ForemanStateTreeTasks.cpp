@@ -1,18 +1,23 @@
 #include "ForemanStateTreeTasks.h"
 
+#include "WytchingStats.h"
 #include "ForemanTypes.h"
+#include "ForemanJobAssignment.h"
+#include "ForemanJobQueue.h"
 #include "Foreman_AIController.h"
 #include "Foreman_BrainComponent.h"
 #include "IWytchCommandable.h"
+#include "AutoBot_Character.h"
 #include "AIController.h"
 #include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
-#include "ForemanSurveyComponent.h"
-#include "Engine/Engine.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "ForemanSlotIndexSubsystem.h"
+#include "ForemanNavCostSubsystem.h"
 #include "SmartObjectSubsystem.h"
 #include "SmartObjectRuntime.h"
 #include "SmartObjectRequestTypes.h"
+#include "HAL/PlatformTime.h"
 
 namespace
 {
@@ -39,6 +44,22 @@ namespace
 			}
 		}
 	}
+
+	bool DispatchToWorker(AActor* Worker, const FSmartObjectRequestResult& Slot, AActor* TargetActor)
+	{
+		if (!Worker || !Worker->Implements<UWytchCommandable>())
+		{
+			return false;
+		}
+
+		// Pass invalid ClaimHandle — worker claims on arrival (DEC-004)
+		IWytchCommandable::Execute_ReceiveSmartObjectAssignment(
+			Worker,
+			FSmartObjectClaimHandle::InvalidHandle,
+			Slot.SlotHandle,
+			TargetActor);
+		return true;
+	}
 }
 
 // ─────────────────────────────────────────────────────────
@@ -49,6 +70,8 @@ EStateTreeRunStatus FForemanTask_PlanJob::EnterState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	WYTCH_SCOPE(STAT_WytchTaskPlanJob);
+
 	FInstanceDataType& Data = Context.GetInstanceData<FInstanceDataType>(*this);
 
 	APawn* Pawn = Data.Pawn.Get();
@@ -62,86 +85,153 @@ EStateTreeRunStatus FForemanTask_PlanJob::EnterState(
 
 	PlayMontageOnPawn(Pawn, Montage);
 
+	AForeman_AIController* ForemanAIC = Cast<AForeman_AIController>(Pawn->GetController());
+	if (!ForemanAIC)
+	{
+		UE_LOG(LogForeman, Warning, TEXT("PlanJob: No AForeman_AIController on pawn"));
+		return EStateTreeRunStatus::Failed;
+	}
+
 	// ── 1. Find available SmartObject slots ──
-	// GetCurrent() returns null if the subsystem isn't ready — no further guard needed.
-	USmartObjectSubsystem* SOSubsystem = USmartObjectSubsystem::GetCurrent(World);
-	if (!SOSubsystem)
+	// Batch mode takes candidates from the work snapshot, single mode from the pending
+	// jobs; either way the slot index confirms each is still free and dispatched or
+	// reserved jobs are skipped.
+	const UForemanSlotIndexSubsystem* SlotIndex = UForemanSlotIndexSubsystem::Get(World);
+	if (!SlotIndex)
 	{
-		UE_LOG(LogForeman, Warning, TEXT("PlanJob: SmartObjectSubsystem unavailable"));
+		UE_LOG(LogForeman, Warning, TEXT("PlanJob: ForemanSlotIndexSubsystem unavailable"));
 		return EStateTreeRunStatus::Failed;
 	}
 
-	FSmartObjectRequest Request;
-	Request.QueryBox = FBox::BuildAABB(Pawn->GetActorLocation(), FVector(5000.f));
-	TArray<FSmartObjectRequestResult> Results;
-	SOSubsystem->FindSmartObjects(Request, Results);
+	FForemanJobQueue& JobQueue = ForemanAIC->GetMutableJobQueue();
 
-	// Pick the closest Free slot
-	FSmartObjectRequestResult BestResult;
-	float BestDistSq = FLT_MAX;
-	bool bFoundSlot = false;
+	Data.DispatchedCount = 0;
 
-	for (const FSmartObjectRequestResult& Result : Results)
+	if (bBatchAssign)
 	{
-		if (SOSubsystem->GetSlotState(Result.SlotHandle) != ESmartObjectSlotState::Free)
-			continue;
-
-		TOptional<FTransform> SlotTransform = SOSubsystem->GetSlotTransform(Result);
-		if (!SlotTransform.IsSet()) continue;
-
-		const float DistSq = FVector::DistSquared(
-			Pawn->GetActorLocation(), SlotTransform.GetValue().GetLocation());
-		if (DistSq < BestDistSq)
+		const FForemanWorkSnapshot& Snapshot = ForemanAIC->GetWorkSnapshot();
+		TArray<const FForemanIndexedSlot*> FreeSlots;
+		FreeSlots.Reserve(Snapshot.FreeSlots.Num());
+		for (const FSmartObjectSlotHandle& SlotHandle : Snapshot.FreeSlots)
 		{
-			BestDistSq = DistSq;
-			BestResult = Result;
-			bFoundSlot = true;
+			const FForemanIndexedSlot* Slot = SlotIndex->FindSlot(SlotHandle);
+			const FForemanJob* Job = JobQueue.FindJob(SlotHandle);
+			if (Slot && Slot->bFree && (!Job || Job->Status == EForemanJobStatus::Pending))
+			{
+				FreeSlots.Add(Slot);
+			}
 		}
+		return PlanAndDispatchBatch(Data, *ForemanAIC, FreeSlots);
 	}
 
-	if (!bFoundSlot)
+	// ── 2. Walk pending jobs in priority order — first one a worker can take wins ──
+	TArray<const FForemanJob*> PendingJobs;
+	JobQueue.GetPendingJobs(PendingJobs);
+
+	if (PendingJobs.IsEmpty())
 	{
-		UE_LOG(LogForeman, Log, TEXT("PlanJob: No free SmartObject slots found"));
+		UE_LOG(LogForeman, Log, TEXT("PlanJob: No pending jobs"));
 		return EStateTreeRunStatus::Failed;
 	}
 
-	// ── 2. Find best idle worker from roster ──
-	AForeman_AIController* ForemanAIC = Cast<AForeman_AIController>(Pawn->GetController());
-	if (!ForemanAIC)
+	for (const FForemanJob* Job : PendingJobs)
 	{
-		UE_LOG(LogForeman, Warning, TEXT("PlanJob: No AForeman_AIController on pawn"));
-		return EStateTreeRunStatus::Failed;
+		const FForemanIndexedSlot* Slot = SlotIndex->FindSlot(Job->SlotHandle);
+		if (!Slot || !Slot->bFree) continue;
+
+		AActor* Worker = SelectIdleWorker(*ForemanAIC, *Slot);
+		if (!Worker && bAllowPreemption)
+		{
+			Worker = PreemptWorkerFor(*ForemanAIC, *Job);
+		}
+		if (!Worker) continue;
+
+		// ── 3. Store result in InstanceData for AssignWorker task ──
+		Data.SelectedSlotResult = Slot->ToRequestResult();
+		Data.SelectedWorker = Worker;
+
+		UE_LOG(LogForeman, Log, TEXT("PlanJob: Planned job %d (priority %d) — worker: %s"),
+			Job->Id, Job->Priority, *Worker->GetName());
+
+		return EStateTreeRunStatus::Succeeded;
 	}
 
-	AActor* BestWorker = nullptr;
-	for (const TWeakObjectPtr<AActor>& WeakWorker : ForemanAIC->GetRegisteredWorkers())
+	UE_LOG(LogForeman, Log, TEXT("PlanJob: No idle worker covers any of %d pending jobs"), PendingJobs.Num());
+	return EStateTreeRunStatus::Failed;
+}
+
+AActor* FForemanTask_PlanJob::SelectIdleWorker(AForeman_AIController& ForemanAIC, const FForemanIndexedSlot& Slot) const
+{
+	// Idle workers in the snapshot that cover the slot, nearest first
+	const FForemanWorkSnapshot& Snapshot = ForemanAIC.GetWorkSnapshot();
+	const FForemanWorkerRoster& Roster = ForemanAIC.GetWorkerRoster();
+
+	TArray<TPair<float, AActor*>> Candidates;
+	for (const TWeakObjectPtr<AActor>& WeakWorker : Snapshot.IdleWorkers)
 	{
 		AActor* Worker = WeakWorker.Get();
 		if (!Worker) continue;
-		if (IWytchCommandable* Commandable = Cast<IWytchCommandable>(Worker))
+		// Snapshot may be up to one scan old — the roster is current
+		if (Roster.GetState(Worker) == EWorkerState::Idle &&
+			Roster.GetCapabilityMask(Worker).Covers(Slot.RequirementMask))
 		{
-			if (Commandable->Execute_GetWorkerState(Worker) == EWorkerState::Idle)
-			{
-				BestWorker = Worker;
-				break;  // First idle worker — capability matching added in Step 3
-			}
+			Candidates.Emplace(FVector::Dist(Worker->GetActorLocation(), Slot.Location), Worker);
 		}
 	}
 
-	if (!BestWorker)
+	if (Candidates.IsEmpty())
 	{
-		UE_LOG(LogForeman, Log, TEXT("PlanJob: No idle workers in roster"));
-		return EStateTreeRunStatus::Failed;
+		return nullptr;
 	}
 
-	// ── 3. Store result in InstanceData for AssignWorker task ──
-	Data.SelectedSlotResult = BestResult;
-	Data.SelectedWorker = BestWorker;
+	Candidates.Sort([](const TPair<float, AActor*>& A, const TPair<float, AActor*>& B) { return A.Key < B.Key; });
 
-	UE_LOG(LogForeman, Log, TEXT("PlanJob: Planned job — worker: %s"),
-		*BestWorker->GetName());
+	UForemanNavCostSubsystem* NavCost = bUseNavPathCost ? UForemanNavCostSubsystem::Get(ForemanAIC.GetWorld()) : nullptr;
+	if (!NavCost)
+	{
+		return Candidates[0].Value;
+	}
 
-	return EStateTreeRunStatus::Succeeded;
+	// Re-rank the nearest few by cached navmesh path length; workers that cannot reach the slot drop out
+	AActor* BestWorker = nullptr;
+	float BestCost = TNumericLimits<float>::Max();
+	const int32 NumPathed = FMath::Min(Candidates.Num(), NavCostCandidatesPerWorker);
+	for (int32 Index = 0; Index < NumPathed; ++Index)
+	{
+		AActor* Worker = Candidates[Index].Value;
+		EForemanNavCostStatus Status;
+		const float Cost = NavCost->GetTravelCost(Worker->GetActorLocation(), Slot.Location, &Status);
+		if (Status != EForemanNavCostStatus::Unreachable && Cost < BestCost)
+		{
+			BestCost = Cost;
+			BestWorker = Worker;
+		}
+	}
+
+	// Every pathed worker is cut off — fall back to the nearest one not yet asked about, if any
+	if (!BestWorker && Candidates.IsValidIndex(NumPathed))
+	{
+		BestWorker = Candidates[NumPathed].Value;
+	}
+	return BestWorker;
+}
+
+AActor* FForemanTask_PlanJob::PreemptWorkerFor(AForeman_AIController& ForemanAIC, const FForemanJob& Job) const
+{
+	FForemanJobQueue& JobQueue = ForemanAIC.GetMutableJobQueue();
+	AActor* Worker = JobQueue.FindPreemptionCandidate(Job, ForemanAIC.GetWorkerRoster());
+	if (!Worker)
+	{
+		return nullptr;
+	}
+
+	// Requeue first — the abort's Idle broadcast must not read as the old job completing
+	JobQueue.MarkPreempted(Worker);
+	IWytchCommandable::Execute_AbortCurrentTask(Worker, EAbortReason::Reassigned);
+
+	UE_LOG(LogForeman, Log, TEXT("PlanJob: preempted %s for job %d (priority %d)"),
+		*Worker->GetName(), Job.Id, Job.Priority);
+	return Worker;
 }
 
 
@@ -153,6 +243,208 @@ EStateTreeRunStatus FForemanTask_PlanJob::Tick(
 	return EStateTreeRunStatus::Succeeded;
 }
 
+EStateTreeRunStatus FForemanTask_PlanJob::PlanAndDispatchBatch(
+	FInstanceDataType& Data,
+	AForeman_AIController& ForemanAIC,
+	const TArray<const FForemanIndexedSlot*>& Slots) const
+{
+	WYTCH_SCOPE(STAT_WytchForemanPlan);
+
+	FForemanWorkSnapshot& Snapshot = ForemanAIC.GetMutableWorkSnapshot();
+
+	// ── 1. Candidate workers: every idle worker in the snapshot ──
+	const FForemanWorkerRoster& Roster = ForemanAIC.GetWorkerRoster();
+
+	TArray<AActor*> Workers;
+	TArray<FWytchCapabilityMask> WorkerMasks;
+
+	for (const TWeakObjectPtr<AActor>& WeakWorker : Snapshot.IdleWorkers)
+	{
+		AActor* Worker = WeakWorker.Get();
+		if (!Worker) continue;
+		if (Roster.GetState(Worker) != EWorkerState::Idle) continue;
+
+		Workers.Add(Worker);
+		WorkerMasks.Add(Roster.GetCapabilityMask(Worker));
+	}
+
+	// With preemption on, an all-busy roster can still serve urgent jobs
+	if (Workers.IsEmpty() && !bAllowPreemption)
+	{
+		UE_LOG(LogForeman, Log, TEXT("PlanJob[batch]: No idle workers in snapshot"));
+		return EStateTreeRunStatus::Failed;
+	}
+
+	// ── 2. Candidate slots — location and requirements come cached from the index ──
+	if (Slots.IsEmpty())
+	{
+		UE_LOG(LogForeman, Log, TEXT("PlanJob[batch]: No free SmartObject slots found"));
+		return EStateTreeRunStatus::Failed;
+	}
+
+	// ── 3. Cost matrix: class-weighted travel cost, infeasible on capability mismatch ──
+	// Masks hold capability bits only — the slot's Task.* tags were mapped when it was indexed.
+	// Each worker's NavCostCandidatesPerWorker nearest slots (straight line) use
+	// cached navmesh path lengths; misses are queued and estimated this pass.
+	// Slots past the pathed few keep their straight-line distance; UnknownCostScale only
+	// applies inside GetTravelCost, to pathed pairs still waiting on a query.
+	UForemanNavCostSubsystem* NavCost = bUseNavPathCost
+		? UForemanNavCostSubsystem::Get(ForemanAIC.GetWorld())
+		: nullptr;
+
+	// Job priority biases the solver towards urgent slots when workers are scarce:
+	// each level below the top pending priority costs PriorityCostPerLevel extra.
+	FForemanJobQueue& JobQueue = ForemanAIC.GetMutableJobQueue();
+	TArray<int32> SlotPriorities;
+	SlotPriorities.Reserve(Slots.Num());
+	int32 TopPriority = TNumericLimits<int32>::Lowest();
+	for (const FForemanIndexedSlot* Slot : Slots)
+	{
+		const FForemanJob* Job = JobQueue.FindJob(Slot->SlotHandle);
+		const int32 Priority = Job ? Job->Priority : 0;
+		SlotPriorities.Add(Priority);
+		TopPriority = FMath::Max(TopPriority, Priority);
+	}
+
+	ForemanAssignment::FCostMatrix Matrix;
+	Matrix.Init(Workers.Num(), Slots.Num());
+
+	TArray<TPair<float, int32>> Candidates;
+	for (int32 W = 0; W < Workers.Num(); ++W)
+	{
+		const FVector WorkerLocation = Workers[W]->GetActorLocation();
+		const float Scale = GetTravelCostScale(Workers[W]);
+
+		Candidates.Reset();
+		for (int32 S = 0; S < Slots.Num(); ++S)
+		{
+			if (!WorkerMasks[W].Covers(Slots[S]->RequirementMask)) continue;
+
+			const float Dist = FVector::Dist(WorkerLocation, Slots[S]->Location);
+			Candidates.Emplace(Dist, S);
+			Matrix.Set(W, S, Dist * Scale);
+		}
+
+		if (NavCost)
+		{
+			Candidates.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+			const int32 NumPathed = FMath::Min(Candidates.Num(), NavCostCandidatesPerWorker);
+			for (int32 Index = 0; Index < NumPathed; ++Index)
+			{
+				const int32 S = Candidates[Index].Value;
+				EForemanNavCostStatus Status;
+				const float PathCost = NavCost->GetTravelCost(WorkerLocation, Slots[S]->Location, &Status);
+				Matrix.Set(W, S, Status == EForemanNavCostStatus::Unreachable
+					? ForemanAssignment::Infeasible
+					: PathCost * Scale);
+			}
+		}
+
+		for (const TPair<float, int32>& Candidate : Candidates)
+		{
+			const int32 S = Candidate.Value;
+			if (Matrix.IsFeasible(W, S))
+			{
+				Matrix.Set(W, S, Matrix.Get(W, S) + (TopPriority - SlotPriorities[S]) * PriorityCostPerLevel);
+			}
+		}
+	}
+
+	// ── 4. Solve ──
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<int32> SlotForWorker;
+	const bool bOptimal = FMath::Max(Workers.Num(), Slots.Num()) <= MaxOptimalProblemSize;
+
+	if (bOptimal)
+	{
+		ForemanAssignment::SolveOptimal(Matrix, SlotForWorker);
+	}
+	else if (!ForemanAssignment::SolveGreedy(Matrix, GreedyTimeBudgetMs / 1000.0, SlotForWorker, GreedyPairsPerWorker))
+	{
+		UE_LOG(LogForeman, Log,
+			TEXT("PlanJob[batch]: greedy solver hit %.2fms budget — remaining pairs wait for next cycle"),
+			GreedyTimeBudgetMs);
+	}
+
+	const double SolveMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	// ── 5. Dispatch every assignment in this pass ──
+	const double Now = ForemanAIC.GetWorld()->GetTimeSeconds();
+	TBitArray<> SlotTaken(false, Slots.Num());
+	int32 Dispatched = 0;
+	for (int32 W = 0; W < Workers.Num(); ++W)
+	{
+		const int32 S = SlotForWorker[W];
+		if (S == INDEX_NONE) continue;
+
+		if (DispatchToWorker(Workers[W], Slots[S]->ToRequestResult(), Slots[S]->Owner.Get()))
+		{
+			Snapshot.MarkAssigned(Workers[W], Slots[S]->SlotHandle);
+			JobQueue.MarkAssigned(Slots[S]->SlotHandle, Workers[W], Now);
+			SlotTaken[S] = true;
+			++Dispatched;
+		}
+	}
+
+	// ── 6. Jobs nobody idle could take — preempt lower-priority work, highest priority first ──
+	int32 Preempted = 0;
+	if (bAllowPreemption)
+	{
+		TArray<int32> Unmatched;
+		for (int32 S = 0; S < Slots.Num(); ++S)
+		{
+			const FForemanJob* Job = SlotTaken[S] ? nullptr : JobQueue.FindJob(Slots[S]->SlotHandle);
+			if (Job && Job->Status == EForemanJobStatus::Pending)
+			{
+				Unmatched.Add(S);
+			}
+		}
+		Unmatched.Sort([&JobQueue, &Slots](int32 A, int32 B)
+		{
+			return FForemanJobQueue::IsHigherRanked(
+				*JobQueue.FindJob(Slots[A]->SlotHandle), *JobQueue.FindJob(Slots[B]->SlotHandle));
+		});
+
+		for (const int32 S : Unmatched)
+		{
+			const FForemanJob* Job = JobQueue.FindJob(Slots[S]->SlotHandle);
+			AActor* Worker = Job ? PreemptWorkerFor(ForemanAIC, *Job) : nullptr;
+			if (!Worker) continue;
+
+			if (DispatchToWorker(Worker, Slots[S]->ToRequestResult(), Slots[S]->Owner.Get()))
+			{
+				Snapshot.MarkAssigned(Worker, Slots[S]->SlotHandle);
+				JobQueue.MarkAssigned(Slots[S]->SlotHandle, Worker, Now);
+				++Dispatched;
+				++Preempted;
+			}
+		}
+	}
+
+	Data.DispatchedCount = Dispatched;
+
+	UE_LOG(LogForeman, Log,
+		TEXT("PlanJob[batch]: %d workers x %d slots -> dispatched %d, %d by preemption (%s, %.3fms)"),
+		Workers.Num(), Slots.Num(), Dispatched, Preempted,
+		bOptimal ? TEXT("optimal") : TEXT("greedy"), SolveMs);
+
+	return Dispatched > 0 ? EStateTreeRunStatus::Succeeded : EStateTreeRunStatus::Failed;
+}
+
+float FForemanTask_PlanJob::GetTravelCostScale(const AActor* Worker) const
+{
+	if (const AAutoBot_Character* AutoBot = Cast<AAutoBot_Character>(Worker))
+	{
+		switch (AutoBot->AutoBotClass)
+		{
+		case EAutoBot_Class::Scout:	return ScoutTravelCostScale;
+		case EAutoBot_Class::Heavy:	return HeavyTravelCostScale;
+		default:					return LightTravelCostScale;
+		}
+	}
+	return LightTravelCostScale;
+}
+
 // ─────────────────────────────────────────────────────────
 // FForemanTask_AssignWorker
 // ─────────────────────────────────────────────────────────
@@ -161,6 +453,8 @@ EStateTreeRunStatus FForemanTask_AssignWorker::EnterState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
+	WYTCH_SCOPE(STAT_WytchForemanAssign);
+
 	FInstanceDataType& Data = Context.GetInstanceData<FInstanceDataType>(*this);
 
 	APawn* Pawn = Data.Pawn.Get();
@@ -178,6 +472,16 @@ EStateTreeRunStatus FForemanTask_AssignWorker::EnterState(
 		return EStateTreeRunStatus::Failed;
 	}
 
+	// The work site receives BeginWork/EndWork — resolve it from the slot index
+	AActor* TargetActor = nullptr;
+	if (const UForemanSlotIndexSubsystem* SlotIndex = UForemanSlotIndexSubsystem::Get(Pawn->GetWorld()))
+	{
+		if (const FForemanIndexedSlot* Slot = SlotIndex->FindSlot(Data.SelectedSlotResult.SlotHandle))
+		{
+			TargetActor = Slot->Owner.Get();
+		}
+	}
+
 	// Notify the worker — worker will claim slot on arrival per DEC-004
 	if (IWytchCommandable* Commandable = Cast<IWytchCommandable>(Worker))
 	{
@@ -186,7 +490,14 @@ EStateTreeRunStatus FForemanTask_AssignWorker::EnterState(
 			Worker,
 			FSmartObjectClaimHandle::InvalidHandle,
 			Data.SelectedSlotResult.SlotHandle,
-			nullptr);  // TargetActor — optional, worker resolves from SlotHandle
+			TargetActor);
+
+		if (AForeman_AIController* ForemanAIC = Cast<AForeman_AIController>(Pawn->GetController()))
+		{
+			ForemanAIC->GetMutableWorkSnapshot().MarkAssigned(Worker, Data.SelectedSlotResult.SlotHandle);
+			ForemanAIC->GetMutableJobQueue().MarkAssigned(
+				Data.SelectedSlotResult.SlotHandle, Worker, Pawn->GetWorld()->GetTimeSeconds());
+		}
 
 		UE_LOG(LogForeman, Log, TEXT("AssignWorker: Sent assignment to %s"),
 			*Worker->GetName());
@@ -206,65 +517,55 @@ EStateTreeRunStatus FForemanTask_Monitor::EnterState(
 	FStateTreeExecutionContext& Context,
 	const FStateTreeTransitionResult& Transition) const
 {
-	FInstanceDataType& Data = Context.GetInstanceData<FInstanceDataType>(*this);
-	Data.ElapsedTime = 0.f;
-
-	PlayMontageOnPawn(Data.Pawn.Get(), Montage);
-
-	UE_LOG(LogForeman, Log, TEXT("Monitor: Entering oversight mode (interval=%.1fs)"),
-		CheckInterval);
-	return EStateTreeRunStatus::Running;
-}
+	WYTCH_SCOPE(STAT_WytchTaskMonitor);
 
-EStateTreeRunStatus FForemanTask_Monitor::Tick(
-	FStateTreeExecutionContext& Context,
-	const float DeltaTime) const
-{
 	FInstanceDataType& Data = Context.GetInstanceData<FInstanceDataType>(*this);
-	Data.ElapsedTime += DeltaTime;
-
-	if (Data.ElapsedTime < CheckInterval)
-	{
-		return EStateTreeRunStatus::Running;
-	}
 
-	Data.ElapsedTime = 0.f;
-
-	// Check if any workers are still actively working
-	APawn* Pawn = Data.Pawn.Get();
-	if (!Pawn)
+	AForeman_AIController* ForemanAIC = Cast<AForeman_AIController>(Data.Controller.Get());
+	if (!ForemanAIC)
 	{
+		UE_LOG(LogForeman, Warning, TEXT("Monitor: No AForeman_AIController — failing"));
 		return EStateTreeRunStatus::Failed;
 	}
 
-	UForemanSurveyComponent* Survey = Pawn->FindComponentByClass<UForemanSurveyComponent>();
-	if (Survey)
+	if (!ForemanAIC->HasActiveWork())
 	{
-		FString Report = Survey->GenerateStatusReport();
-		UE_LOG(LogForeman, Warning, TEXT("%s"), *Report);
-		GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Cyan, Report);
+		UE_LOG(LogForeman, Log, TEXT("Monitor: No active work — returning to dispatch"));
+		return EStateTreeRunStatus::Succeeded;
 	}
 
-	TArray<AActor*> WorkStations;
-	UGameplayStatics::GetAllActorsWithTag(
-		Pawn->GetWorld(), FName(TEXT("WorkStation")), WorkStations);
+	PlayMontageOnPawn(Data.Pawn.Get(), Montage);
 
-	bool bAnyActive = false;
-	for (AActor* WS : WorkStations)
-	{
-		if (WS && WS->Tags.Contains(FName(TEXT("Claimed"))))
+	// Finish from whichever event drops the last active worker
+	FStateTreeWeakExecutionContext WeakContext = Context.MakeWeakExecutionContext();
+	TWeakObjectPtr<AForeman_AIController> WeakForeman = ForemanAIC;
+
+	Data.WorkerActivityHandle = ForemanAIC->OnWorkerActivityChanged.AddLambda(
+		[WeakContext](AForeman_AIController* Foreman) mutable
 		{
-			bAnyActive = true;
-			break;
-		}
-	}
+			if (Foreman && !Foreman->HasActiveWork())
+			{
+				UE_LOG(LogForeman, Log, TEXT("Monitor: Last active worker done — returning to dispatch"));
+				WeakContext.FinishTask(EStateTreeFinishTaskType::Succeeded);
+			}
+		});
 
-	if (!bAnyActive)
+	// Blueprint-only workers don't broadcast — a released slot is the cue to re-poll them
+	if (UForemanSlotIndexSubsystem* SlotIndex = UForemanSlotIndexSubsystem::Get(ForemanAIC->GetWorld()))
 	{
-		UE_LOG(LogForeman, Log, TEXT("Monitor: No active work — returning to dispatch"));
-		return EStateTreeRunStatus::Succeeded;
+		Data.SlotFreedHandle = SlotIndex->OnSlotFreed.AddLambda(
+			[WeakForeman](const FForemanIndexedSlot&)
+			{
+				if (AForeman_AIController* Foreman = WeakForeman.Get())
+				{
+					Foreman->PollUnobservedWorkers();
+				}
+			});
 	}
 
+	UE_LOG(LogForeman, Log, TEXT("Monitor: Overseeing %d active workers, %d jobs pending"),
+		ForemanAIC->GetWorkerRoster().GetActiveWorkers().Num(),
+		ForemanAIC->GetJobQueue().GetNumPending());
 	return EStateTreeRunStatus::Running;
 }
 
@@ -373,6 +674,18 @@ void FForemanTask_Monitor::ExitState(
 {
 	FInstanceDataType& Data = Context.GetInstanceData<FInstanceDataType>(*this);
 	StopMontageOnPawn(Data.Pawn.Get(), Montage);
+
+	if (AForeman_AIController* ForemanAIC = Cast<AForeman_AIController>(Data.Controller.Get()))
+	{
+		ForemanAIC->OnWorkerActivityChanged.Remove(Data.WorkerActivityHandle);
+
+		if (UForemanSlotIndexSubsystem* SlotIndex = UForemanSlotIndexSubsystem::Get(ForemanAIC->GetWorld()))
+		{
+			SlotIndex->OnSlotFreed.Remove(Data.SlotFreedHandle);
+		}
+	}
+	Data.WorkerActivityHandle.Reset();
+	Data.SlotFreedHandle.Reset();
 }
 
 void FForemanTask_Wait::ExitState(
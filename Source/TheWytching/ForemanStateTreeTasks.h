@@ -9,8 +9,11 @@
 #include "ForemanStateTreeTasks.generated.h"
 
 class AAIController;
+class AForeman_AIController;
 class APawn;
 class UForeman_BrainComponent;
+struct FForemanIndexedSlot;
+struct FForemanJob;
 
 // ─────────────────────────────────────────────────────────
 // Shared instance data: all Foreman tasks need the controller + pawn
@@ -29,8 +32,10 @@ struct FForemanTaskInstanceData
 
 // ─────────────────────────────────────────────────────────
 // FForemanTask_PlanJob
-//   Scans registered workstations, scores by distance/priority,
-//   selects the best available target for dispatch.
+//   Takes pending jobs from the Foreman's job queue in priority
+//   order, scores workers by travel cost, and selects the best
+//   pairing for dispatch. Preempts lower-priority work when no
+//   idle worker fits a job.
 // ─────────────────────────────────────────────────────────
 USTRUCT()
 struct FForemanTask_PlanJobInstanceData : public FForemanTaskInstanceData
@@ -48,6 +53,10 @@ struct FForemanTask_PlanJobInstanceData : public FForemanTaskInstanceData
 	// Internal: the selected idle worker
 	UPROPERTY()
 	TObjectPtr<AActor> SelectedWorker = nullptr;
+
+	// Output: assignments dispatched directly by PlanJob in batch mode
+	UPROPERTY(EditAnywhere, Category = "Output")
+	int32 DispatchedCount = 0;
 };
 
 USTRUCT(meta = (DisplayName = "Foreman: Plan Job"))
@@ -60,6 +69,56 @@ struct THEWYTCHING_API FForemanTask_PlanJob : public FStateTreeTaskCommonBase
 	UPROPERTY(EditAnywhere, Category = "Animation")
 	TObjectPtr<UAnimMontage> Montage = nullptr;
 
+	// Batch mode: pair every idle worker with a free slot in one pass and
+	// dispatch them all here. AssignWorker is not needed after a batch plan —
+	// wire Plan straight to Monitor in ST_Foreman.
+	UPROPERTY(EditAnywhere, Category = "Batch")
+	bool bBatchAssign = false;
+
+	// Problems up to this many workers/slots use the optimal (Hungarian) solver;
+	// larger ones fall back to greedy under GreedyTimeBudgetMs.
+	UPROPERTY(EditAnywhere, Category = "Batch", meta = (EditCondition = "bBatchAssign", ClampMin = "1"))
+	int32 MaxOptimalProblemSize = 64;
+
+	// Covers the greedy solver's pair build and sort as well as its matching pass.
+	UPROPERTY(EditAnywhere, Category = "Batch", meta = (EditCondition = "bBatchAssign", ClampMin = "0.0"))
+	float GreedyTimeBudgetMs = 1.0f;
+
+	// The greedy solver only considers each worker's cheapest few slots. 0 = all.
+	UPROPERTY(EditAnywhere, Category = "Batch", meta = (EditCondition = "bBatchAssign", ClampMin = "0"))
+	int32 GreedyPairsPerWorker = 16;
+
+	// Travel cost multipliers per EAutoBot_Class — heavies are slow, scouts are quick.
+	UPROPERTY(EditAnywhere, Category = "Batch", meta = (EditCondition = "bBatchAssign", ClampMin = "0.1"))
+	float ScoutTravelCostScale = 0.75f;
+
+	UPROPERTY(EditAnywhere, Category = "Batch", meta = (EditCondition = "bBatchAssign", ClampMin = "0.1"))
+	float LightTravelCostScale = 1.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Batch", meta = (EditCondition = "bBatchAssign", ClampMin = "0.1"))
+	float HeavyTravelCostScale = 1.5f;
+
+	// Score the nearest candidates by navmesh path length (UForemanNavCostSubsystem)
+	// instead of straight-line distance. Uncached paths are queried asynchronously
+	// and estimated until the result lands; unreachable candidates are skipped.
+	UPROPERTY(EditAnywhere, Category = "Navigation")
+	bool bUseNavPathCost = false;
+
+	// How many nearest (straight-line) slots per worker — or workers per slot in
+	// single mode — get a path cost.
+	UPROPERTY(EditAnywhere, Category = "Navigation", meta = (EditCondition = "bUseNavPathCost", ClampMin = "1"))
+	int32 NavCostCandidatesPerWorker = 4;
+
+	// When no idle worker covers a job, abort (EAbortReason::Reassigned) a worker
+	// on a strictly lower-priority job and send it instead.
+	UPROPERTY(EditAnywhere, Category = "Jobs")
+	bool bAllowPreemption = true;
+
+	// Batch mode: extra travel cost (world units) per priority level below the
+	// highest pending job — biases scarce workers towards urgent slots.
+	UPROPERTY(EditAnywhere, Category = "Jobs", meta = (EditCondition = "bBatchAssign", ClampMin = "0.0"))
+	float PriorityCostPerLevel = 2000.f;
+
 	virtual const UStruct* GetInstanceDataType() const override
 	{
 		return FInstanceDataType::StaticStruct();
@@ -70,6 +129,19 @@ struct THEWYTCHING_API FForemanTask_PlanJob : public FStateTreeTaskCommonBase
 
 	virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context,
 		const float DeltaTime) const override;
+
+private:
+	/** Cheapest idle worker in the snapshot that covers Slot, or nullptr. */
+	AActor* SelectIdleWorker(AForeman_AIController& ForemanAIC, const FForemanIndexedSlot& Slot) const;
+
+	/** Aborts a lower-priority worker for Job and returns it (now idle), or nullptr. */
+	AActor* PreemptWorkerFor(AForeman_AIController& ForemanAIC, const FForemanJob& Job) const;
+
+	EStateTreeRunStatus PlanAndDispatchBatch(FInstanceDataType& Data,
+		AForeman_AIController& ForemanAIC,
+		const TArray<const FForemanIndexedSlot*>& Slots) const;
+
+	float GetTravelCostScale(const AActor* Worker) const;
 };
 
 // ─────────────────────────────────────────────────────────
@@ -98,15 +170,17 @@ struct THEWYTCHING_API FForemanTask_AssignWorker : public FStateTreeTaskCommonBa
 
 // ─────────────────────────────────────────────────────────
 // FForemanTask_Monitor
-//   Foreman moves to an oversight position and monitors
-//   active worker progress. Succeeds when no active work.
+//   Foreman oversees active workers. Does not tick: listens to
+//   the Foreman's worker-activity event and SmartObject slot
+//   releases, and succeeds the moment no worker is active.
 // ─────────────────────────────────────────────────────────
 USTRUCT()
 struct FForemanTask_MonitorInstanceData : public FForemanTaskInstanceData
 {
 	GENERATED_BODY()
 
-	float ElapsedTime = 0.f;
+	FDelegateHandle WorkerActivityHandle;
+	FDelegateHandle SlotFreedHandle;
 };
 
 USTRUCT(meta = (DisplayName = "Foreman: Monitor"))
@@ -116,8 +190,11 @@ struct THEWYTCHING_API FForemanTask_Monitor : public FStateTreeTaskCommonBase
 
 	using FInstanceDataType = FForemanTask_MonitorInstanceData;
 
-	UPROPERTY(EditAnywhere, Category = "Parameter")
-	float CheckInterval = 3.f;
+	FForemanTask_Monitor()
+	{
+		// Completion is event-driven
+		bShouldCallTick = false;
+	}
 
 	UPROPERTY(EditAnywhere, Category = "Animation")
 	TObjectPtr<UAnimMontage> Montage = nullptr;
@@ -130,9 +207,6 @@ struct THEWYTCHING_API FForemanTask_Monitor : public FStateTreeTaskCommonBase
 	virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context,
 		const FStateTreeTransitionResult& Transition) const override;
 
-	virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context,
-		const float DeltaTime) const override;
-
 	virtual void ExitState(FStateTreeExecutionContext& Context,
 		const FStateTreeTransitionResult& Transition) const override;
 };
@@ -0,0 +1,54 @@
+#include "ForemanWorkSnapshot.h"
+
+#include "WytchingStats.h"
+#include "Foreman_AIController.h"
+#include "ForemanSlotIndexSubsystem.h"
+
+void FForemanWorkSnapshot::Refresh(const AForeman_AIController& ForemanAIC,
+	const UForemanSlotIndexSubsystem* SlotIndex,
+	const FBox& WorkZone)
+{
+	WYTCH_SCOPE(STAT_WytchForemanSnapshot);
+
+	IdleWorkers.Reset();
+	ActiveWorkers.Reset();
+	FreeSlots.Reset();
+
+	// The roster keeps these sets current from worker events — copy, don't re-query
+	const FForemanWorkerRoster& Roster = ForemanAIC.GetWorkerRoster();
+	IdleWorkers.Reserve(Roster.GetIdleWorkers().Num());
+	for (const TWeakObjectPtr<AActor>& Worker : Roster.GetIdleWorkers())
+	{
+		IdleWorkers.Add(Worker);
+	}
+
+	ActiveWorkers.Reserve(Roster.GetActiveWorkers().Num());
+	for (const TWeakObjectPtr<AActor>& Worker : Roster.GetActiveWorkers())
+	{
+		ActiveWorkers.Add(Worker);
+	}
+
+	if (SlotIndex)
+	{
+		TArray<const FForemanIndexedSlot*> Slots;
+		SlotIndex->GetFreeSlots(WorkZone, Slots);
+
+		FreeSlots.Reserve(Slots.Num());
+		for (const FForemanIndexedSlot* Slot : Slots)
+		{
+			FreeSlots.Add(Slot->SlotHandle);
+		}
+	}
+
+	++Generation;
+}
+
+void FForemanWorkSnapshot::MarkAssigned(AActor* Worker, FSmartObjectSlotHandle SlotHandle)
+{
+	if (IdleWorkers.RemoveSingleSwap(Worker) > 0)
+	{
+		ActiveWorkers.Add(Worker);
+	}
+	FreeSlots.RemoveSingleSwap(SlotHandle);
+	++Generation;
+}
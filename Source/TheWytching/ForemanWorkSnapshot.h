@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SmartObjectRuntime.h"
+
+class AActor;
+class AForeman_AIController;
+class UForemanSlotIndexSubsystem;
+
+// ─────────────────────────────────────────────────────────
+// FForemanWorkSnapshot — one Foreman's view of its work zone
+//   Refreshed once per scan by FForemanEval_WorkAvailability and
+//   read by conditions and PlanJob, so transition checks cost O(1)
+//   instead of re-walking the roster. Dispatches move workers and
+//   slots out of the idle/free sets immediately (MarkAssigned), so
+//   the snapshot never offers the same pair twice between scans.
+// ─────────────────────────────────────────────────────────
+struct THEWYTCHING_API FForemanWorkSnapshot
+{
+	TArray<TWeakObjectPtr<AActor>> IdleWorkers;
+
+	/** Workers in MovingToTask, Working or Returning. */
+	TArray<TWeakObjectPtr<AActor>> ActiveWorkers;
+
+	/** Free SmartObject slots inside the work zone at refresh time. */
+	TArray<FSmartObjectSlotHandle> FreeSlots;
+
+	/** Bumped on every Refresh and MarkAssigned. 0 = never refreshed. */
+	uint32 Generation = 0;
+
+	bool HasIdleWorkers() const { return IdleWorkers.Num() > 0; }
+	bool HasFreeSlots() const { return FreeSlots.Num() > 0; }
+
+	/** Rebuilds every set from the roster and the slot index. */
+	void Refresh(const AForeman_AIController& ForemanAIC,
+		const UForemanSlotIndexSubsystem* SlotIndex,
+		const FBox& WorkZone);
+
+	/** Records a dispatch made between refreshes. */
+	void MarkAssigned(AActor* Worker, FSmartObjectSlotHandle SlotHandle);
+};
@@ -0,0 +1,208 @@
+#include "ForemanWorkerRoster.h"
+
+#include "IWytchCommandable.h"
+#include "GameFramework/Actor.h"
+
+bool FForemanWorkerRoster::Add(AActor* Worker, EWorkerState State,
+	const FGameplayTagContainer& Capabilities, bool bObserved)
+{
+	if (!Worker || Entries.Contains(Worker))
+	{
+		return false;
+	}
+
+	FEntry& Entry = Entries.Add(Worker);
+	Entry.Index = Workers.Add(Worker);
+	Entry.State = State;
+	Entry.BucketTags = Capabilities.GetGameplayTagParents();
+	Entry.CapabilityMask = FWytchCapabilityRegistry::Get().MakeWorkerMask(Entry.BucketTags);
+	Entry.bObserved = bObserved;
+
+	if (!bObserved)
+	{
+		++NumUnobserved;
+	}
+
+	LinkState(Worker, Entry);
+	return true;
+}
+
+bool FForemanWorkerRoster::Remove(const TWeakObjectPtr<AActor>& Worker)
+{
+	FEntry Entry;
+	if (!Entries.RemoveAndCopyValue(Worker, Entry))
+	{
+		return false;
+	}
+
+	UnlinkState(Worker, Entry);
+
+	if (!Entry.bObserved)
+	{
+		--NumUnobserved;
+	}
+
+	// Swap-remove and fix up the moved worker's index
+	Workers.RemoveAtSwap(Entry.Index);
+	if (Workers.IsValidIndex(Entry.Index))
+	{
+		Entries.FindChecked(Workers[Entry.Index]).Index = Entry.Index;
+	}
+	return true;
+}
+
+void FForemanWorkerRoster::Reset()
+{
+	Workers.Reset();
+	Entries.Reset();
+	IdleWorkers.Reset();
+	ActiveWorkers.Reset();
+	UnavailableWorkers.Reset();
+	IdleByCapability.Reset();
+	NumUnobserved = 0;
+}
+
+void FForemanWorkerRoster::UpdateState(AActor* Worker, EWorkerState NewState)
+{
+	FEntry* Entry = Entries.Find(Worker);
+	if (!Entry || Entry->State == NewState)
+	{
+		return;
+	}
+
+	UnlinkState(Worker, *Entry);
+	Entry->State = NewState;
+	LinkState(Worker, *Entry);
+}
+
+void FForemanWorkerRoster::UpdateCapabilities(AActor* Worker, const FGameplayTagContainer& Capabilities)
+{
+	FEntry* Entry = Entries.Find(Worker);
+	if (!Entry)
+	{
+		return;
+	}
+
+	FGameplayTagContainer BucketTags = Capabilities.GetGameplayTagParents();
+	if (BucketTags == Entry->BucketTags)
+	{
+		return;
+	}
+
+	UnlinkState(Worker, *Entry);
+	Entry->BucketTags = MoveTemp(BucketTags);
+	Entry->CapabilityMask = FWytchCapabilityRegistry::Get().MakeWorkerMask(Entry->BucketTags);
+	LinkState(Worker, *Entry);
+}
+
+bool FForemanWorkerRoster::PollUnobserved()
+{
+	if (NumUnobserved == 0)
+	{
+		return false;
+	}
+
+	bool bChanged = false;
+	for (TPair<TWeakObjectPtr<AActor>, FEntry>& Pair : Entries)
+	{
+		if (Pair.Value.bObserved) continue;
+
+		AActor* Worker = Pair.Key.Get();
+		if (!Worker) continue;
+
+		const EWorkerState State = IWytchCommandable::Execute_GetWorkerState(Worker);
+		const FGameplayTagContainer BucketTags =
+			IWytchCommandable::Execute_GetCapabilities(Worker).GetGameplayTagParents();
+
+		if (State != Pair.Value.State || BucketTags != Pair.Value.BucketTags)
+		{
+			UnlinkState(Pair.Key, Pair.Value);
+			Pair.Value.State = State;
+			Pair.Value.BucketTags = BucketTags;
+			Pair.Value.CapabilityMask = FWytchCapabilityRegistry::Get().MakeWorkerMask(BucketTags);
+			LinkState(Pair.Key, Pair.Value);
+			bChanged = true;
+		}
+	}
+	return bChanged;
+}
+
+AActor* FForemanWorkerRoster::FindIdleWorker(FGameplayTag Capability) const
+{
+	const TSet<TWeakObjectPtr<AActor>>* Bucket = Capability.IsValid()
+		? IdleByCapability.Find(Capability)
+		: &IdleWorkers;
+
+	if (Bucket)
+	{
+		for (const TWeakObjectPtr<AActor>& Worker : *Bucket)
+		{
+			if (AActor* Resolved = Worker.Get())
+			{
+				return Resolved;
+			}
+		}
+	}
+	return nullptr;
+}
+
+int32 FForemanWorkerRoster::GetNumIdle(FGameplayTag Capability) const
+{
+	if (!Capability.IsValid())
+	{
+		return IdleWorkers.Num();
+	}
+	const TSet<TWeakObjectPtr<AActor>>* Bucket = IdleByCapability.Find(Capability);
+	return Bucket ? Bucket->Num() : 0;
+}
+
+EWorkerState FForemanWorkerRoster::GetState(AActor* Worker) const
+{
+	const FEntry* Entry = Entries.Find(Worker);
+	return Entry ? Entry->State : EWorkerState::Unavailable;
+}
+
+FWytchCapabilityMask FForemanWorkerRoster::GetCapabilityMask(AActor* Worker) const
+{
+	const FEntry* Entry = Entries.Find(Worker);
+	return Entry ? Entry->CapabilityMask : FWytchCapabilityMask();
+}
+
+TSet<TWeakObjectPtr<AActor>>& FForemanWorkerRoster::GetStateSet(EWorkerState State)
+{
+	switch (State)
+	{
+	case EWorkerState::Idle:		return IdleWorkers;
+	case EWorkerState::Unavailable:	return UnavailableWorkers;
+	default:						return ActiveWorkers;
+	}
+}
+
+void FForemanWorkerRoster::LinkState(const TWeakObjectPtr<AActor>& Worker, const FEntry& Entry)
+{
+	GetStateSet(Entry.State).Add(Worker);
+
+	if (Entry.State == EWorkerState::Idle)
+	{
+		for (const FGameplayTag& Tag : Entry.BucketTags)
+		{
+			IdleByCapability.FindOrAdd(Tag).Add(Worker);
+		}
+	}
+}
+
+void FForemanWorkerRoster::UnlinkState(const TWeakObjectPtr<AActor>& Worker, const FEntry& Entry)
+{
+	GetStateSet(Entry.State).Remove(Worker);
+
+	if (Entry.State == EWorkerState::Idle)
+	{
+		for (const FGameplayTag& Tag : Entry.BucketTags)
+		{
+			if (TSet<TWeakObjectPtr<AActor>>* Bucket = IdleByCapability.Find(Tag))
+			{
+				Bucket->Remove(Worker);
+			}
+		}
+	}
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "AndroidTypes.h"
+#include "WytchCapabilityMask.h"
+
+class AActor;
+
+// ─────────────────────────────────────────────────────────
+// FForemanWorkerRoster — the Foreman's registered workers
+//   Keeps idle / active / unavailable sets and per-capability
+//   idle buckets, updated from IWytchCommandable state-change
+//   events. Workers without a native delegate (Blueprint-only
+//   implementers) are marked unobserved and polled by
+//   PollUnobserved() once per Foreman scan.
+//
+//   Capability buckets include parent tags, so a Task.Carry.Heavy
+//   worker is found by FindIdleWorker(Task.Carry) — matching
+//   FGameplayTagContainer::HasAll semantics.
+// ─────────────────────────────────────────────────────────
+class THEWYTCHING_API FForemanWorkerRoster
+{
+public:
+	/** Returns false if the worker is already registered. */
+	bool Add(AActor* Worker, EWorkerState State, const FGameplayTagContainer& Capabilities, bool bObserved);
+
+	/** Returns false if the worker was not registered. */
+	bool Remove(const TWeakObjectPtr<AActor>& Worker);
+
+	void Reset();
+
+	bool Contains(AActor* Worker) const { return Entries.Contains(Worker); }
+	int32 Num() const { return Workers.Num(); }
+
+	void UpdateState(AActor* Worker, EWorkerState NewState);
+	void UpdateCapabilities(AActor* Worker, const FGameplayTagContainer& Capabilities);
+
+	/** Re-queries GetWorkerState/GetCapabilities for workers that do not broadcast. Returns true if any changed. */
+	bool PollUnobserved();
+
+	/** Any idle worker carrying Capability (or any idle worker if Capability is empty). O(1). */
+	AActor* FindIdleWorker(FGameplayTag Capability = FGameplayTag()) const;
+
+	int32 GetNumIdle(FGameplayTag Capability = FGameplayTag()) const;
+
+	EWorkerState GetState(AActor* Worker) const;
+
+	/** Worker capabilities as a bitmask (parents included). Empty if not registered. */
+	FWytchCapabilityMask GetCapabilityMask(AActor* Worker) const;
+
+	/** Registration order is not preserved — removal swaps. */
+	const TArray<TWeakObjectPtr<AActor>>& GetWorkers() const { return Workers; }
+	const TSet<TWeakObjectPtr<AActor>>& GetIdleWorkers() const { return IdleWorkers; }
+	const TSet<TWeakObjectPtr<AActor>>& GetActiveWorkers() const { return ActiveWorkers; }
+	const TSet<TWeakObjectPtr<AActor>>& GetUnavailableWorkers() const { return UnavailableWorkers; }
+
+private:
+	struct FEntry
+	{
+		int32 Index = INDEX_NONE;
+		EWorkerState State = EWorkerState::Idle;
+
+		/** Capabilities expanded with parent tags — the bucket keys. */
+		FGameplayTagContainer BucketTags;
+
+		/** BucketTags as a bitmask. */
+		FWytchCapabilityMask CapabilityMask;
+
+		bool bObserved = false;
+	};
+
+	TSet<TWeakObjectPtr<AActor>>& GetStateSet(EWorkerState State);
+
+	void LinkState(const TWeakObjectPtr<AActor>& Worker, const FEntry& Entry);
+	void UnlinkState(const TWeakObjectPtr<AActor>& Worker, const FEntry& Entry);
+
+	TArray<TWeakObjectPtr<AActor>> Workers;
+	TMap<TWeakObjectPtr<AActor>, FEntry> Entries;
+
+	TSet<TWeakObjectPtr<AActor>> IdleWorkers;
+	TSet<TWeakObjectPtr<AActor>> ActiveWorkers;
+	TSet<TWeakObjectPtr<AActor>> UnavailableWorkers;
+
+	TMap<FGameplayTag, TSet<TWeakObjectPtr<AActor>>> IdleByCapability;
+
+	int32 NumUnobserved = 0;
+};
@@ -1,8 +1,13 @@
 #include "Foreman_AIController.h"
 
+#include "WytchingStats.h"
 #include "AndroidConditionComponent.h"
+#include "ForemanRegistrySubsystem.h"
+#include "ForemanSlotIndexSubsystem.h"
 #include "ForemanTypes.h"
 #include "Foreman_BrainComponent.h"
+#include "IWytchCommandable.h"
+#include "WytchMassWorkerSubsystem.h"
 #include "Components/StateTreeAIComponent.h"
 #include "StateTree.h"
 #include "Perception/AIPerceptionComponent.h"
@@ -40,6 +45,12 @@ void AForeman_AIController::BeginPlay()
 		ForemanBrain->RequestBoot();
 	}
 
+	// Join the Foreman registry — workers are sharded by work zone
+	if (UForemanRegistrySubsystem* Registry = UForemanRegistrySubsystem::Get(GetWorld()))
+	{
+		Registry->RegisterForeman(this);
+	}
+
 	// Set the StateTree from the DefaultStateTree property if not already running
 	if (StateTreeAI != nullptr && DefaultStateTree != nullptr)
 	{
@@ -112,6 +123,8 @@ void AForeman_AIController::OnUnPossess()
 
 void AForeman_AIController::ExecuteMoveToLocation(FVector Destination)
 {
+	WYTCH_SCOPE(STAT_WytchForemanMove);
+
 	FAIMoveRequest MoveRequest;
 	MoveRequest.SetGoalLocation(Destination);
 	MoveRequest.SetAcceptanceRadius(50.f);
@@ -132,6 +145,8 @@ void AForeman_AIController::ExecuteMoveToLocation(FVector Destination)
 
 void AForeman_AIController::ExecuteMoveToActor(AActor* Target)
 {
+	WYTCH_SCOPE(STAT_WytchForemanMove);
+
 	if (!Target)
 	{
 		UE_LOG(LogForeman, Warning, TEXT("ExecuteMoveToActor called with null target"));
@@ -159,26 +174,250 @@ void AForeman_AIController::ExecuteMoveToActor(AActor* Target)
 void AForeman_AIController::RegisterWorker(AActor* Worker)
 {
 	if (!Worker) return;
-	// Avoid duplicates
-	for (const TWeakObjectPtr<AActor>& Entry : RegisteredWorkers)
+	if (!Worker->Implements<UWytchCommandable>())
+	{
+		UE_LOG(LogForeman, Warning, TEXT("RegisterWorker: %s does not implement IWytchCommandable — ignored"),
+			*Worker->GetName());
+		return;
+	}
+
+	// Native implementers broadcast state changes; Blueprint-only ones are polled
+	IWytchCommandable* Commandable = Cast<IWytchCommandable>(Worker);
+	FOnWytchWorkerStateChanged* StateChanged = Commandable ? Commandable->GetWorkerStateChangedDelegate() : nullptr;
+
+	if (!WorkerRoster.Add(
+		Worker,
+		IWytchCommandable::Execute_GetWorkerState(Worker),
+		IWytchCommandable::Execute_GetCapabilities(Worker),
+		/*bObserved=*/StateChanged != nullptr))
 	{
-		if (Entry.Get() == Worker) return;
+		return;  // Already registered
 	}
-	RegisteredWorkers.Add(Worker);
+
+	if (StateChanged)
+	{
+		WorkerStateHandles.Add(Worker,
+			StateChanged->AddUObject(this, &AForeman_AIController::HandleWorkerStateChanged));
+	}
+
+	// Keeps one Foreman per worker — the previous owner (if any) drops it
+	if (UForemanRegistrySubsystem* Registry = UForemanRegistrySubsystem::Get(GetWorld()))
+	{
+		Registry->NotifyWorkerRegistered(Worker, this);
+	}
+
+	OnWorkerActivityChanged.Broadcast(this);
+
 	UE_LOG(LogForeman, Log, TEXT("RegisterWorker: %s — roster size: %d"),
-		*Worker->GetName(), RegisteredWorkers.Num());
+		*Worker->GetName(), WorkerRoster.Num());
 }
 
 void AForeman_AIController::UnregisterWorker(AActor* Worker)
 {
 	if (!Worker) return;
-	const int32 Before = RegisteredWorkers.Num();
-	RegisteredWorkers.RemoveAll([Worker](const TWeakObjectPtr<AActor>& Entry)
+	const int32 Before = WorkerRoster.Num();
+
+	FDelegateHandle Handle;
+	if (WorkerStateHandles.RemoveAndCopyValue(Worker, Handle))
+	{
+		if (IWytchCommandable* Commandable = Cast<IWytchCommandable>(Worker))
+		{
+			if (FOnWytchWorkerStateChanged* StateChanged = Commandable->GetWorkerStateChangedDelegate())
+			{
+				StateChanged->Remove(Handle);
+			}
+		}
+	}
+
+	WorkerRoster.Remove(Worker);
+
+	// Its job (if any) goes back to the queue
+	JobQueue.HandleWorkerStateChanged(Worker, EWorkerState::Unavailable, GetWorld()->GetTimeSeconds());
+
+	if (UForemanRegistrySubsystem* Registry = UForemanRegistrySubsystem::Get(GetWorld()))
+	{
+		Registry->NotifyWorkerUnregistered(Worker, this);
+	}
+
+	if (WorkerRoster.Num() != Before)
 	{
-		return !Entry.IsValid() || Entry.Get() == Worker;
-	});
+		OnWorkerActivityChanged.Broadcast(this);
+	}
+
 	UE_LOG(LogForeman, Log, TEXT("UnregisterWorker: %s — roster size: %d -> %d"),
-		*Worker->GetName(), Before, RegisteredWorkers.Num());
+		*Worker->GetName(), Before, WorkerRoster.Num());
+}
+
+void AForeman_AIController::HandleWorkerStateChanged(AActor* Worker, EWorkerState OldState, EWorkerState NewState)
+{
+	if (OldState == NewState)
+	{
+		// Capability-only change
+		WorkerRoster.UpdateCapabilities(Worker, IWytchCommandable::Execute_GetCapabilities(Worker));
+		return;
+	}
+
+	WorkerRoster.UpdateState(Worker, NewState);
+	JobQueue.HandleWorkerStateChanged(Worker, NewState, GetWorld()->GetTimeSeconds());
+	OnWorkerActivityChanged.Broadcast(this);
+}
+
+void AForeman_AIController::PollUnobservedWorkers()
+{
+	if (WorkerRoster.PollUnobserved())
+	{
+		OnWorkerActivityChanged.Broadcast(this);
+	}
+}
+
+void AForeman_AIController::SyncJobQueue()
+{
+	WYTCH_SCOPE(STAT_WytchForemanJobSync);
+
+	const UForemanSlotIndexSubsystem* SlotIndex = UForemanSlotIndexSubsystem::Get(GetWorld());
+	if (!SlotIndex) return;
+
+	JobQueue.Sync(WorkSnapshot, *SlotIndex, WorkerRoster, JobPolicies, DefaultJobPolicy,
+		GetWorld()->GetTimeSeconds());
+}
+
+void AForeman_AIController::PreassignFollowUpJobs()
+{
+	WYTCH_SCOPE(STAT_WytchForemanPreassign);
+
+	if (!bPreassignFollowUpJobs) return;
+
+	UForemanSlotIndexSubsystem* SlotIndex = UForemanSlotIndexSubsystem::Get(GetWorld());
+	if (!SlotIndex) return;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	TArray<const FForemanJob*> Finishing;
+	JobQueue.GetWorkersFinishingWithin(Now, FollowUpLeadTime, Finishing);
+	if (Finishing.IsEmpty()) return;
+
+	TArray<const FForemanJob*> Pending;
+	JobQueue.GetPendingJobs(Pending);
+
+	for (const FForemanJob* Current : Finishing)
+	{
+		if (Pending.IsEmpty()) break;
+
+		AActor* Worker = Current->Worker.Get();
+		if (!Worker) continue;
+
+		// Highest-ranked job the worker covers; nearest to its current site among equal priority
+		const FWytchCapabilityMask WorkerMask = WorkerRoster.GetCapabilityMask(Worker);
+		int32 BestIndex = INDEX_NONE;
+		double BestDistSq = TNumericLimits<double>::Max();
+		for (int32 Index = 0; Index < Pending.Num(); ++Index)
+		{
+			const FForemanJob* Job = Pending[Index];
+			if (BestIndex != INDEX_NONE && Job->Priority < Pending[BestIndex]->Priority) break;
+			if (!WorkerMask.Covers(Job->RequirementMask)) continue;
+
+			const double DistSq = FVector::DistSquared(Current->Location, Job->Location);
+			if (DistSq < BestDistSq)
+			{
+				BestDistSq = DistSq;
+				BestIndex = Index;
+			}
+		}
+		if (BestIndex == INDEX_NONE) continue;
+
+		const FForemanJob* Next = Pending[BestIndex];
+		const FSmartObjectSlotHandle SlotHandle = Next->SlotHandle;
+		if (!IWytchCommandable::Execute_QueueFollowUpAssignment(Worker, SlotHandle, Next->Site.Get()))
+		{
+			continue;
+		}
+
+		JobQueue.MarkReserved(SlotHandle, Worker, *SlotIndex);
+		WorkSnapshot.MarkAssigned(Worker, SlotHandle);
+		Pending.RemoveAt(BestIndex);
+
+		UE_LOG(LogForeman, Log, TEXT("Foreman: reserved follow-up job for %s (%.1fs left on current)"),
+			*Worker->GetName(), Current->ArrivedTime + Current->WorkDuration - Now);
+	}
+}
+
+void AForeman_AIController::DispatchMassWorkers()
+{
+	WYTCH_SCOPE(STAT_WytchForemanMassDispatch);
+
+	// Actor workers first — entities only take what the idle actors leave
+	if (!bDispatchMassWorkers || WorkSnapshot.HasIdleWorkers()) return;
+
+	UWytchMassWorkerSubsystem* MassWorkers = UWytchMassWorkerSubsystem::Get(GetWorld());
+	const UForemanSlotIndexSubsystem* SlotIndex = UForemanSlotIndexSubsystem::Get(GetWorld());
+	if (!MassWorkers || MassWorkers->Num() == 0 || !SlotIndex) return;
+
+	TArray<const FForemanJob*> Pending;
+	JobQueue.GetPendingJobs(Pending);
+
+	const FBox Zone = GetWorkZone();
+	int32 Dispatched = 0;
+
+	for (const FForemanJob* Job : Pending)
+	{
+		if (Dispatched >= MaxMassDispatchPerScan) break;
+
+		const FForemanIndexedSlot* Slot = SlotIndex->FindSlot(Job->SlotHandle);
+		if (!Slot || !Slot->bFree) continue;
+
+		const FMassEntityHandle Entity = MassWorkers->FindIdleWorker(Zone, Job->RequirementMask, Job->Location);
+		if (!Entity.IsSet()) continue;
+
+		// The entity claims the slot, so the next Sync drops the job from the queue
+		const FSmartObjectSlotHandle SlotHandle = Job->SlotHandle;
+		if (!MassWorkers->AssignWorker(Entity, SlotHandle, Job->Site.Get(), Job->Location)) continue;
+
+		WorkSnapshot.MarkAssigned(nullptr, SlotHandle);
+		++Dispatched;
+	}
+
+	if (Dispatched > 0)
+	{
+		UE_LOG(LogForeman, Log, TEXT("Foreman: dispatched %d Mass worker(s) to pending jobs"), Dispatched);
+	}
+}
+
+void AForeman_AIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Hand our workers to the remaining Foremen first
+	if (UForemanRegistrySubsystem* Registry = UForemanRegistrySubsystem::Get(GetWorld()))
+	{
+		Registry->UnregisterForeman(this);
+	}
+
+	// Workers may outlive us — drop our bindings from their delegates
+	TArray<TWeakObjectPtr<AActor>> Workers = WorkerRoster.GetWorkers();
+	for (const TWeakObjectPtr<AActor>& Worker : Workers)
+	{
+		if (AActor* Resolved = Worker.Get())
+		{
+			UnregisterWorker(Resolved);
+		}
+	}
+	WorkerRoster.Reset();
+	WorkerStateHandles.Reset();
+	JobQueue.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+FBox AForeman_AIController::GetWorkZone() const
+{
+	const APawn* OwnedPawn = GetPawn();
+	return OwnedPawn
+		? FBox::BuildAABB(OwnedPawn->GetActorLocation(), FVector(WorkZoneRadius))
+		: FBox(ForceInit);
+}
+
+bool AForeman_AIController::IsInWorkZone(const FVector& Location) const
+{
+	const FBox Zone = GetWorkZone();
+	return Zone.IsValid && Zone.IsInsideOrOn(Location);
 }
 
 UAndroidConditionComponent* AForeman_AIController::GetOwnCondition() const
@@ -2,6 +2,10 @@
 
 #include "CoreMinimal.h"
 #include "AIController.h"
+#include "ForemanWorkSnapshot.h"
+#include "ForemanWorkerRoster.h"
+#include "ForemanJobQueue.h"
+#include "AndroidTypes.h"
 #include "Foreman_AIController.generated.h"
 
 class UStateTree;
@@ -9,6 +13,9 @@ class UStateTreeAIComponent;
 class UForeman_BrainComponent;
 class UAndroidConditionComponent;
 
+/** The Foreman's set of active (moving/working/returning) workers may have changed. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnForemanWorkerActivityChanged, AForeman_AIController* /*Foreman*/);
+
 UCLASS()
 class THEWYTCHING_API AForeman_AIController : public AAIController
 {
@@ -19,6 +26,7 @@ public:
 	virtual void BeginPlay() override;
 	virtual void OnPossess(APawn* InPawn) override;
 	virtual void OnUnPossess() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// Movement helpers
 	void ExecuteMoveToLocation(FVector Destination);
@@ -39,7 +47,44 @@ public:
 	void UnregisterWorker(AActor* Worker);
 
 	// C++ accessor only — TWeakObjectPtr arrays are not Blueprint-compatible
-	const TArray<TWeakObjectPtr<AActor>>& GetRegisteredWorkers() const { return RegisteredWorkers; }
+	const TArray<TWeakObjectPtr<AActor>>& GetRegisteredWorkers() const { return WorkerRoster.GetWorkers(); }
+
+	// Idle/active/unavailable sets + capability buckets, kept current from worker events
+	const FForemanWorkerRoster& GetWorkerRoster() const { return WorkerRoster; }
+
+	/** Re-reads state for workers that don't broadcast (Blueprint-only implementers). */
+	void PollUnobservedWorkers();
+
+	/** Any registered worker moving to, doing or returning from a job. O(1). */
+	bool HasActiveWork() const { return WorkerRoster.GetActiveWorkers().Num() > 0; }
+
+	/** Fired on worker state changes, registration changes and polled changes. */
+	FOnForemanWorkerActivityChanged OnWorkerActivityChanged;
+
+	// Work zone — the region this Foreman owns for worker sharding (see UForemanRegistrySubsystem)
+	FBox GetWorkZone() const;
+	bool IsInWorkZone(const FVector& Location) const;
+
+	// Work snapshot — refreshed by the WorkAvailability evaluator, read by conditions/tasks
+	const FForemanWorkSnapshot& GetWorkSnapshot() const { return WorkSnapshot; }
+	FForemanWorkSnapshot& GetMutableWorkSnapshot() { return WorkSnapshot; }
+
+	// Job queue — synced from the snapshot each scan, consumed by PlanJob
+	const FForemanJobQueue& GetJobQueue() const { return JobQueue; }
+	FForemanJobQueue& GetMutableJobQueue() { return JobQueue; }
+
+	/** Brings the job queue in line with the current work snapshot. */
+	void SyncJobQueue();
+
+	/** Reserves the next job for workers within FollowUpLeadTime of finishing. */
+	void PreassignFollowUpJobs();
+
+	/** Sends idle Mass worker entities (UWytchMassWorkerSubsystem) to pending jobs no idle actor can take. */
+	void DispatchMassWorkers();
+
+	/** Queue depth and creation → arrival latency. */
+	UFUNCTION(BlueprintCallable, Category = "Foreman|Jobs")
+	FForemanJobQueueStats GetJobQueueStats() const { return JobQueue.GetStats(); }
 
 protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Foreman|AI")
@@ -51,6 +96,48 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Foreman|Brain")
 	TObjectPtr<UForeman_BrainComponent> ForemanBrain;
 
-	UPROPERTY(VisibleAnywhere, Category = "Foreman|Workers")
-	TArray<TWeakObjectPtr<AActor>> RegisteredWorkers;
+	/** Half-extent of the work zone around the Foreman pawn. Slots and zone-owned workers are drawn from it. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Foreman|Workers", meta = (ClampMin = "100"))
+	float WorkZoneRadius = 5000.f;
+
+	/** Priority and deadline per task type (IWytchWorkSite::GetTaskType). Parent tags match children. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Foreman|Jobs")
+	TMap<FGameplayTag, FForemanJobPolicy> JobPolicies;
+
+	/** Policy for task types with no JobPolicies entry. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Foreman|Jobs")
+	FForemanJobPolicy DefaultJobPolicy;
+
+	/** Queue a follow-up job on workers about to finish, so they chain into it with no idle gap. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Foreman|Jobs")
+	bool bPreassignFollowUpJobs = true;
+
+	/**
+	 * Seconds before a worker's work ends (IWytchWorkSite::GetInteractionDuration)
+	 * that its follow-up is reserved. Keep above the WorkAvailability ScanInterval.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Foreman|Jobs",
+		meta = (EditCondition = "bPreassignFollowUpJobs", ClampMin = "0.0"))
+	float FollowUpLeadTime = 2.f;
+
+	/** Dispatch pending jobs to Mass worker entities in the work zone when no actor worker is idle. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Foreman|Jobs")
+	bool bDispatchMassWorkers = true;
+
+	/** Entity dispatches per scan — each claims a slot and may promote to an actor on arrival. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Foreman|Jobs",
+		meta = (EditCondition = "bDispatchMassWorkers", ClampMin = "1"))
+	int32 MaxMassDispatchPerScan = 8;
+
+	FForemanWorkerRoster WorkerRoster;
+
+	/** State-change subscriptions for workers that broadcast (see IWytchCommandable). */
+	TMap<TWeakObjectPtr<AActor>, FDelegateHandle> WorkerStateHandles;
+
+	FForemanWorkSnapshot WorkSnapshot;
+
+	FForemanJobQueue JobQueue;
+
+private:
+	void HandleWorkerStateChanged(AActor* Worker, EWorkerState OldState, EWorkerState NewState);
 };
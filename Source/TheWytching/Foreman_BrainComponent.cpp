@@ -15,6 +15,12 @@
 #include "Perception/AIPerceptionSystem.h"
 #include "Perception/AIPerceptionStimuliSourceComponent.h"
 #include "Navigation/PathFollowingComponent.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "WytchBrainSession.h"
+#include "WytchEventLog.h"
+#include "WytchLatencyStats.h"
 
 namespace
 {
@@ -62,9 +68,97 @@ UForeman_BrainComponent::UForeman_BrainComponent()
 void UForeman_BrainComponent::BeginPlay()
 {
 	Super::BeginPlay();
+	if (!LLMBackend)
+	{
+		LLMBackend = IWytchLLMBackend::CreateDefault();
+	}
+
+	FString ReplayPath;
+	if (FParse::Value(FCommandLine::Get(), TEXT("WytchReplayLLM="), ReplayPath))
+	{
+		float TimeScale = 1.f;
+		FParse::Value(FCommandLine::Get(), TEXT("WytchReplayScale="), TimeScale);
+		StartReplay(ReplayPath, TimeScale);
+	}
+	else if (FParse::Param(FCommandLine::Get(), TEXT("WytchRecordLLM")))
+	{
+		StartRecording(FWytchBrainSession::MakeDefaultPath(GetNameSafe(GetOwner())));
+	}
 	RequestBoot();
 }
 
+void UForeman_BrainComponent::SetLLMBackend(TSharedPtr<IWytchLLMBackend> InBackend)
+{
+	StopRecording();
+	ReplayBackend.Reset();
+	SnapIntervalScale = 1.f;
+
+	LLMBackend = InBackend ? InBackend : TSharedPtr<IWytchLLMBackend>(IWytchLLMBackend::CreateDefault());
+}
+
+bool UForeman_BrainComponent::StartRecording(const FString& Path)
+{
+	StopRecording();
+
+	TSharedRef<FWytchRecordingLLMBackend> Recorder = MakeShared<FWytchRecordingLLMBackend>(
+		LLMBackend ? LLMBackend.ToSharedRef() : IWytchLLMBackend::CreateDefault(), Path);
+	if (!Recorder->IsOpen())
+	{
+		return false;
+	}
+
+	RecordingBackend = Recorder;
+	LLMBackend = Recorder;
+	WYTCH_EVENT(Brain, Info, TEXT("Recording session to %s"), *Path);
+	return true;
+}
+
+void UForeman_BrainComponent::StopRecording()
+{
+	if (!RecordingBackend) return;
+
+	// Only unwrap if nothing replaced the recorder since
+	if (LLMBackend == RecordingBackend)
+	{
+		LLMBackend = RecordingBackend->GetInner();
+	}
+	RecordingBackend->Close();
+	WYTCH_EVENT(Brain, Info, TEXT("Recorded %d snaps to %s"),
+		RecordingBackend->GetNumSnaps(), *RecordingBackend->GetPath());
+	RecordingBackend.Reset();
+}
+
+bool UForeman_BrainComponent::StartReplay(const FString& Path, float TimeScale)
+{
+	FWytchBrainSession Session;
+	FString Error;
+	if (!FWytchBrainSession::Load(Path, Session, Error))
+	{
+		WYTCH_EVENT(Brain, Error, TEXT("Replay: %s"), *Error);
+		return false;
+	}
+
+	const int32 NumSnaps = Session.Snaps.Num();
+
+	SetLLMBackend(MakeShared<FWytchReplayLLMBackend>(MoveTemp(Session), TimeScale));
+	ReplayBackend = StaticCastSharedPtr<FWytchReplayLLMBackend>(LLMBackend);
+	SnapIntervalScale = ReplayBackend->GetTimeScale();
+
+	WYTCH_EVENT(Brain, Info, TEXT("Replaying %d snaps from %s at x%.2f"), NumSnaps, *Path, SnapIntervalScale);
+
+	// TickReplay issues the first recorded command once booted, even if it matches the live one
+	CurrentCommand.Reset();
+	return true;
+}
+
+void UForeman_BrainComponent::StopReplay()
+{
+	if (!ReplayBackend) return;
+
+	WYTCH_EVENT(Brain, Info, TEXT("Replay stopped — %d divergent snaps"), ReplayBackend->GetNumDivergences());
+	SetLLMBackend(nullptr);
+}
+
 void UForeman_BrainComponent::RequestBoot()
 {
 	bBootRequested = true;
@@ -101,6 +195,8 @@ void UForeman_BrainComponent::ShutdownBoot()
 
 	PerceivedRedCone = nullptr;
 	LastPerceivedActors.Reset();
+	PerceivedTagIndex.Reset();
+	NavigationTarget.Reset();
 	SetState(EForemanState::Idle);
 }
 
@@ -110,8 +206,8 @@ bool UForeman_BrainComponent::InitialiseComponents()
 	AActor* ForemanActor = GetForemanActor();
 	if (!Owner || !ForemanActor)
 	{
-		UE_LOG(LogTemp, Verbose,
-			TEXT("Foreman: Brain boot waiting (Owner=%s ForemanActor=%s)"),
+		WYTCH_EVENT(Brain, Trace,
+			TEXT("Brain boot waiting (Owner=%s ForemanActor=%s)"),
 			Owner ? *Owner->GetName() : TEXT("None"),
 			ForemanActor ? *ForemanActor->GetName() : TEXT("None"));
 		return false;
@@ -145,8 +241,8 @@ bool UForeman_BrainComponent::InitialiseComponents()
 		USceneComponent* RootComponent = ForemanActor->GetRootComponent();
 		if (!RootComponent)
 		{
-			UE_LOG(LogTemp, Warning,
-				TEXT("Foreman: No root component for %s"),
+			WYTCH_EVENT(Brain, Warning,
+				TEXT("No root component for %s"),
 				*ForemanActor->GetName());
 			return false;
 		}
@@ -197,10 +293,7 @@ bool UForeman_BrainComponent::InitialiseComponents()
 		}
 	}
 
-	UE_LOG(LogTemp, Warning,
-		TEXT("Foreman: Kellan brain initialised, ready for commands"));
-	GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Cyan,
-		TEXT("Foreman Kellan: Ready"));
+	WYTCH_EVENT(Brain, Info, TEXT("Kellan brain initialised, ready for commands"));
 	return true;
 }
 
@@ -208,33 +301,24 @@ void UForeman_BrainComponent::IssueCommand(const FString& Command)
 {
 	if (!bBooted)
 	{
-		UE_LOG(LogTemp, Warning,
-			TEXT("Foreman: Ignoring command '%s' because brain is not booted yet"),
+		WYTCH_EVENT(Brain, Warning,
+			TEXT("Ignoring command '%s' because brain is not booted yet"),
 			*Command);
 		return;
 	}
 
-	UE_LOG(LogTemp, Warning,
-		TEXT("Foreman: IssueCommand called: %s"), *Command);
 	CurrentCommand = Command;
-	UE_LOG(LogTemp, Warning, TEXT("Foreman: Command received - %s"),
-		*Command);
-	GEngine->AddOnScreenDebugMessage(-1, 30.f, FColor::Yellow,
-		FString::Printf(TEXT("Foreman Command: %s"), *Command));
+	WYTCH_EVENT(Brain, Info, TEXT("Command: %s"), *Command);
 
 	// Save current forward yaw
 	AActor* ForemanActor = GetForemanActor();
 	if (ForemanActor)
 	{
 		InitialForwardYaw = ForemanActor->GetActorRotation().Yaw;
-		UE_LOG(LogTemp, Warning, TEXT("Foreman: Saved initial yaw: %.1f"), InitialForwardYaw);
-		GEngine->AddOnScreenDebugMessage(-1, 30.f, FColor::Cyan,
-			FString::Printf(TEXT("Initial Yaw: %.1f"), InitialForwardYaw));
+		WYTCH_EVENT(Brain, Trace, TEXT("Saved initial yaw: %.1f"), InitialForwardYaw);
 	}
 
 	SetState(EForemanState::LookingAround);
-	UE_LOG(LogTemp, Warning,
-		TEXT("Foreman: State set to LookingAround"));
 }
 
 void UForeman_BrainComponent::SetState(EForemanState NewState)
@@ -286,8 +370,8 @@ void UForeman_BrainComponent::SetState(EForemanState NewState)
 		bHasSavedRotationSettings = false;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Foreman: State -> %d"),
-		(int32)NewState);
+	WYTCH_EVENT(Brain, Trace, TEXT("State %d -> %d"),
+		(int32)PreviousState, (int32)NewState);
 }
 
 void UForeman_BrainComponent::TickComponent(float DeltaTime,
@@ -305,6 +389,11 @@ void UForeman_BrainComponent::TickComponent(float DeltaTime,
 		}
 	}
 
+	if (ReplayBackend)
+	{
+		TickReplay();
+	}
+
 	switch (CurrentState)
 	{
 		case EForemanState::LookingAround:
@@ -319,12 +408,37 @@ void UForeman_BrainComponent::TickComponent(float DeltaTime,
 	}
 }
 
+void UForeman_BrainComponent::TickReplay()
+{
+	// Commands change between snaps — never under an in-flight request
+	if (bWaitingForLLMResponse) return;
+
+	const FWytchBrainSessionSnap* NextSnap = ReplayBackend->GetNextSnap();
+	if (!NextSnap)
+	{
+		// Let the brain act on the last response; stop once it would snap again
+		if (CurrentState == EForemanState::LookingAround || CurrentState == EForemanState::Idle)
+		{
+			WYTCH_EVENT(Brain, Info, TEXT("Replay: session finished"));
+			StopReplay();
+			SetState(EForemanState::Idle);
+		}
+		return;
+	}
+
+	// The recorded operator issued a new command before this snap — do the same
+	if (!NextSnap->Command.IsEmpty() && !NextSnap->Command.Equals(CurrentCommand, ESearchCase::CaseSensitive))
+	{
+		IssueCommand(NextSnap->Command);
+	}
+}
+
 void UForeman_BrainComponent::TickLookAround(float DeltaTime)
 {
 	if (bWaitingForLLMResponse) return;
 
 	LookAroundTimer += DeltaTime;
-	if (LookAroundTimer < SnapInterval) return;
+	if (LookAroundTimer < SnapInterval * SnapIntervalScale) return;
 	LookAroundTimer = 0.f;
 
 	// Rotate Foreman to scan the scene
@@ -335,13 +449,9 @@ void UForeman_BrainComponent::TickLookAround(float DeltaTime)
 		float CurrentYaw = StartYaw + (LookAroundSnapsCount * 90.f);
 		FRotator ScanRotation(0.f, FRotator::NormalizeAxis(CurrentYaw), 0.f);
 
-		UE_LOG(LogTemp, Warning, 
-			TEXT("Foreman: Snap %d rotating to yaw %.1f"),
-			LookAroundSnapsCount, CurrentYaw);
-
-		GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Cyan,
-			FString::Printf(TEXT("Snap %d → Yaw: %.1f (start: %.1f + offset: %d*90)"),
-				LookAroundSnapsCount, CurrentYaw, StartYaw, LookAroundSnapsCount));
+		WYTCH_EVENT(Brain, Trace,
+			TEXT("Snap %d rotating to yaw %.1f (start %.1f)"),
+			LookAroundSnapsCount, CurrentYaw, StartYaw);
 
 		// CRITICAL: Rotate the entire actor body (not just controller/head)
 		// SetControlRotation only moves the head - we need the whole capsule to turn
@@ -382,9 +492,15 @@ void UForeman_BrainComponent::HandleMoveToComplete()
 {
 	if (CurrentState == EForemanState::NavigatingToTarget)
 	{
-		// Find and pick up target
-		AActor* Target = FindActorByTag(TargetActorTag);
-		if (!Target) return;
+		// Pick up the actor resolved when the move was issued
+		AActor* Target = NavigationTarget.Get();
+		if (!Target)
+		{
+			WYTCH_EVENT(Brain, Warning,
+				TEXT("Target '%s' no longer exists"), *TargetActorTag);
+			SetState(EForemanState::Idle);
+			return;
+		}
 
 		// Check distance to ensure we actually reached it
 		float DistToCone = FVector::Dist(
@@ -394,10 +510,8 @@ void UForeman_BrainComponent::HandleMoveToComplete()
 		if (DistToCone > 150.f)
 		{
 			// Didn't actually reach it, try again
-			UE_LOG(LogTemp, Warning, 
-				TEXT("Foreman: Didn't reach target, retrying (distance: %.1f)"), DistToCone);
-			GEngine->AddOnScreenDebugMessage(-1, 30.f, FColor::Orange,
-				FString::Printf(TEXT("Too far (%.1f), retrying move"), DistToCone));
+			WYTCH_EVENT(Brain, Info,
+				TEXT("Didn't reach target, retrying (distance: %.1f)"), DistToCone);
 			AForeman_AIController* Controller = GetForemanController();
 			if (Controller)
 			{
@@ -406,8 +520,7 @@ void UForeman_BrainComponent::HandleMoveToComplete()
 			return;
 		}
 
-		GEngine->AddOnScreenDebugMessage(-1, 30.f, FColor::Green,
-			TEXT("Foreman: Arrived at target"));
+		WYTCH_EVENT(Brain, Info, TEXT("Arrived at target"));
 		SetState(EForemanState::PickingUp);
 		PickUpActor(Target);
 	}
@@ -416,20 +529,15 @@ void UForeman_BrainComponent::HandleMoveToComplete()
 		// Validate we're still holding something
 		if (!HeldActor)
 		{
-			UE_LOG(LogTemp, Error,
-				TEXT("Foreman: Arrived at destination but holding nothing!"));
-			GEngine->AddOnScreenDebugMessage(-1, 30.f, FColor::Red,
-				TEXT("Foreman: ERROR - arrived but holding nothing"));
+			WYTCH_EVENT(Brain, Error,
+				TEXT("Arrived at destination but holding nothing"));
 			SetState(EForemanState::Idle);
 			return;
 		}
 
-		GEngine->AddOnScreenDebugMessage(-1, 30.f, FColor::Green,
-			TEXT("Foreman: Arrived at destination"));
 		PlaceHeldActor(TargetLocation);
 		SetState(EForemanState::TaskComplete);
-		GEngine->AddOnScreenDebugMessage(-1, 30.f, FColor::Cyan,
-			TEXT("Foreman: Task Complete!"));
+		WYTCH_EVENT(Brain, Info, TEXT("Arrived at destination — task complete"));
 	}
 }
 
@@ -450,19 +558,13 @@ void UForeman_BrainComponent::PickUpActor(AActor* Target)
 	// Verify attachment succeeded
 	if (!Target->GetAttachParentActor())
 	{
-		UE_LOG(LogTemp, Error, 
-			TEXT("Foreman: Pickup FAILED - attachment rejected"));
-		GEngine->AddOnScreenDebugMessage(-1, 30.f, FColor::Red,
-			TEXT("Foreman: Pickup failed - check Mobility"));
+		WYTCH_EVENT(Brain, Error,
+			TEXT("Pickup failed - attachment rejected, check Mobility"));
 		HeldActor = nullptr;
 		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Foreman: Pickup CONFIRMED - %s attached"),
-		*Target->GetName());
-	GEngine->AddOnScreenDebugMessage(-1, 30.f, FColor::Green,
-		FString::Printf(TEXT("Foreman: Picked up %s"),
-			*Target->GetName()));
+	WYTCH_EVENT(Brain, Info, TEXT("Picked up %s"), *Target->GetName());
 
 	// Now navigate to center
 	TargetLocation = FVector::ZeroVector;
@@ -483,31 +585,49 @@ void UForeman_BrainComponent::PlaceHeldActor(FVector Location)
 	HeldActor->SetActorLocation(Location);
 	HeldActor = nullptr;
 
-	UE_LOG(LogTemp, Warning,
-		TEXT("Foreman: Placed object at center"));
+	WYTCH_EVENT(Brain, Trace, TEXT("Placed object at center"));
 }
 
 void UForeman_BrainComponent::SnapAndAnalyse()
 {
-	if (!SceneCapture || !RenderTarget) return;
+	WYTCH_SCOPE(STAT_WytchBrainSnap);
+
+	if (!SceneCapture || !RenderTarget || !LLMBackend) return;
 
 	bWaitingForLLMResponse = true;
-	SceneCapture->CaptureScene();
+	LLMTrace.BeginRoundTrip(TEXT("Foreman"));
+	SnapStartSeconds = FPlatformTime::Seconds();
 
-	FString Base64 = RenderTargetToBase64();
-	if (Base64.IsEmpty())
+	// Backends that ignore the image (mock) skip capture — there may be no RHI to read back from
+	FString Base64;
+	if (LLMBackend->WantsImage())
 	{
-		bWaitingForLLMResponse = false;
-		return;
+		{
+			WYTCH_SCOPE(STAT_WytchBrainCapture);
+			SceneCapture->CaptureScene();
+		}
+
+		Base64 = RenderTargetToBase64();
+		if (Base64.IsEmpty())
+		{
+			bWaitingForLLMResponse = false;
+			LLMTrace.EndRoundTrip();
+			return;
+		}
 	}
 
-	FString Context = BuildPerceptionContext();
+	FString Context;
+	{
+		WYTCH_SCOPE(STAT_WytchBrainContext);
+		Context = BuildPerceptionContext();
+	}
 	SendToLLM(Base64, Context);
 }
 
 FString UForeman_BrainComponent::BuildPerceptionContext()
 {
 	LastPerceivedActors.Empty();
+	PerceivedTagIndex.Reset();
 	AActor* ForemanActor = GetForemanActor();
 	const FVector ForemanLocation = ForemanActor
 		? ForemanActor->GetActorLocation()
@@ -559,6 +679,9 @@ FString UForeman_BrainComponent::BuildPerceptionContext()
 			}
 		}
 
+		// First actor wins on duplicate tags, same as the old linear scan
+		PerceivedTagIndex.FindOrAdd(Tag, Actor);
+
 		FVector Pos = Actor->GetActorLocation();
 		float Dist = FVector::Dist(
 			ForemanLocation, Pos);
@@ -579,14 +702,13 @@ FString UForeman_BrainComponent::BuildPerceptionContext()
 void UForeman_BrainComponent::SendToLLM(const FString& Base64,
 	const FString& Context)
 {
-	FHttpRequestRef Request = FHttpModule::Get().CreateRequest();
-	Request->SetURL(LMStudioURL);
-	Request->SetVerb(TEXT("POST"));
-	Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	WYTCH_SCOPE(STAT_WytchBrainSend);
 
 	FString EscapedContext = EscapeForJson(Context);
 
-	FString Body = FString::Printf(TEXT(R"({
+	FWytchLLMRequest Request;
+	Request.URL = LMStudioURL;
+	Request.Body = FString::Printf(TEXT(R"({
 		"model": "liquid/lfm2.5-vl-1.6b",
 		"messages": [
 			{
@@ -618,66 +740,83 @@ void UForeman_BrainComponent::SendToLLM(const FString& Base64,
 		"max_tokens": 300
 	})"), *EscapedContext, *Base64);
 
-	Request->SetContentAsString(Body);
-	Request->OnProcessRequestComplete().BindUObject(this,
-		&UForeman_BrainComponent::OnLLMResponse);
-	Request->ProcessRequest();
+	Request.Command = CurrentCommand;
+	Request.Context = Context;
+	if (RecordingBackend)
+	{
+		// Only the recorder wants the image a second time
+		Request.ImageBase64 = Base64;
+	}
+
+	RequestSentSeconds = FPlatformTime::Seconds();
+	LLMBackend->Send(Request, FOnWytchLLMResponse::CreateUObject(this,
+		&UForeman_BrainComponent::OnLLMResponse));
+	LLMTrace.BeginNetwork();
 }
 
-void UForeman_BrainComponent::OnLLMResponse(FHttpRequestPtr Request,
-	FHttpResponsePtr Response,
-	bool bWasSuccessful)
+void UForeman_BrainComponent::OnLLMResponse(const FWytchLLMResponse& Response)
 {
-	check(Request);  // Callback signature requires it, even if unused
 	bWaitingForLLMResponse = false;
 
-	if (!bWasSuccessful || !Response.IsValid())
+	// Whatever of the round trip the backend itself didn't account for was spent queued
+	const double ResponseSeconds = FPlatformTime::Seconds();
+	const double RoundTrip = ResponseSeconds - RequestSentSeconds;
+	const double Network = FMath::Clamp(Response.NetworkSeconds, 0.0, RoundTrip);
+	FWytchLatencyStats::Record(EWytchLatencyStage::BrainNetwork, Network);
+	FWytchLatencyStats::Record(EWytchLatencyStage::BrainQueueWait, RoundTrip - Network);
+
+	LLMTrace.EndNetwork();
+	ON_SCOPE_EXIT { LLMTrace.EndRoundTrip(); };
+
+	if (!Response.bSuccess)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Foreman: LLM request failed"));
+		WYTCH_EVENT(Brain, Error, TEXT("LLM request failed"));
 		return;
 	}
 
-	FString Raw = Response->GetContentAsString();
-	TSharedPtr<FJsonObject> Outer;
-	TSharedRef<TJsonReader<>> Reader =
-		TJsonReaderFactory<>::Create(Raw);
+	TSharedPtr<FJsonObject> Inner;
+	{
+		WYTCH_SCOPE(STAT_WytchBrainParse);
+		FWytchLatencyTimer ParseTimer(EWytchLatencyStage::BrainParse);
 
-	if (!FJsonSerializer::Deserialize(Reader, Outer)) return;
+		const FString& Raw = Response.Content;
+		TSharedPtr<FJsonObject> Outer;
+		TSharedRef<TJsonReader<>> Reader =
+			TJsonReaderFactory<>::Create(Raw);
 
-	TArray<TSharedPtr<FJsonValue>> Choices =
-		Outer->GetArrayField(TEXT("choices"));
-	if (Choices.Num() == 0) return;
+		if (!FJsonSerializer::Deserialize(Reader, Outer)) return;
 
-	FString Content = Choices[0]->AsObject()
-		->GetObjectField(TEXT("message"))
-		->GetStringField(TEXT("content"));
+		TArray<TSharedPtr<FJsonValue>> Choices =
+			Outer->GetArrayField(TEXT("choices"));
+		if (Choices.Num() == 0) return;
 
-	Content = SanitizeJson(Content);
+		FString Content = Choices[0]->AsObject()
+			->GetObjectField(TEXT("message"))
+			->GetStringField(TEXT("content"));
 
-	TSharedPtr<FJsonObject> Inner;
-	TSharedRef<TJsonReader<>> InnerReader =
-		TJsonReaderFactory<>::Create(Content);
+		Content = SanitizeJson(Content);
 
-	if (!FJsonSerializer::Deserialize(InnerReader, Inner))
-	{
-		UE_LOG(LogTemp, Error,
-			TEXT("Foreman: JSON parse failed - %s"), *Content);
-		return;
+		TSharedRef<TJsonReader<>> InnerReader =
+			TJsonReaderFactory<>::Create(Content);
+
+		if (!FJsonSerializer::Deserialize(InnerReader, Inner))
+		{
+			WYTCH_EVENT(Brain, Error,
+				TEXT("JSON parse failed - %s"), *Content);
+			return;
+		}
 	}
 
+	WYTCH_SCOPE(STAT_WytchBrainAction);
+
 	bool bTargetFound = Inner->GetBoolField(TEXT("target_found"));
 	FString TargetTag = Inner->GetStringField(TEXT("target_tag"));
 
-	UE_LOG(LogTemp, Warning,
-		TEXT("Foreman sees: %s | Target found: %s"),
+	WYTCH_EVENT(Brain, Info,
+		TEXT("Kellan sees: %s | Target found: %s"),
 		*Inner->GetStringField(TEXT("summary")),
 		bTargetFound ? TEXT("YES") : TEXT("NO"));
 
-	GEngine->AddOnScreenDebugMessage(-1, 30.f,
-		bTargetFound ? FColor::Green : FColor::Yellow,
-		FString::Printf(TEXT("Kellan: %s"),
-			*Inner->GetStringField(TEXT("summary"))));
-
 	if (bTargetFound && !TargetTag.IsEmpty())
 	{
 		// Target located - navigate to it
@@ -685,16 +824,15 @@ void UForeman_BrainComponent::OnLLMResponse(FHttpRequestPtr Request,
 		if (Target)
 		{
 			TargetActorTag = TargetTag;
+			NavigationTarget = Target;
 			AForeman_AIController* Controller = GetForemanController();
 			if (Controller)
 			{
 				Controller->ExecuteMoveToActor(Target);
+				FWytchLatencyStats::Record(EWytchLatencyStage::BrainActionStart,
+					FPlatformTime::Seconds() - ResponseSeconds);
 				SetState(EForemanState::NavigatingToTarget);
-				GEngine->AddOnScreenDebugMessage(-1, 30.f,
-					FColor::Green,
-					FString::Printf(
-						TEXT("Kellan: Found %s, moving to it"),
-						*TargetTag));
+				WYTCH_EVENT(Brain, Info, TEXT("Found %s, moving to it"), *TargetTag);
 			}
 		}
 	}
@@ -702,8 +840,7 @@ void UForeman_BrainComponent::OnLLMResponse(FHttpRequestPtr Request,
 		LookAroundSnapsCount >= 4)
 	{
 		// Completed full rotation, target not found
-		GEngine->AddOnScreenDebugMessage(-1, 30.f, FColor::Orange,
-			TEXT("Kellan: Target not found after full scan"));
+		WYTCH_EVENT(Brain, Info, TEXT("Target not found after full scan"));
 		SetState(EForemanState::Idle);
 	}
 }
@@ -744,8 +881,8 @@ void UForeman_BrainComponent::ConfigurePerceptionSenses()
 	PerceptionComponent->OnTargetPerceptionInfoUpdated.AddDynamic(
 		this, &UForeman_BrainComponent::OnTargetPerceptionUpdated);
 
-	UE_LOG(LogTemp, Log,
-		TEXT("Foreman: Perception configured: sight radius=%.0f"),
+	WYTCH_EVENT(Perception, Trace,
+		TEXT("Perception configured: sight radius=%.0f"),
 		SightConfig->SightRadius);
 }
 
@@ -760,9 +897,8 @@ void UForeman_BrainComponent::OnTargetPerceptionUpdated(
 
 	const bool bSuccessfullySensed = UpdateInfo.Stimulus.WasSuccessfullySensed();
 
-	// Log perception event
-	UE_LOG(LogTemp, Warning,
-		TEXT("Foreman: Perceived '%s' (success=%d)"),
+	WYTCH_EVENT(Perception, Trace,
+		TEXT("Perceived '%s' (success=%d)"),
 		*TargetActor->GetName(),
 		(int32)bSuccessfullySensed);
 
@@ -772,22 +908,16 @@ void UForeman_BrainComponent::OnTargetPerceptionUpdated(
 		if (TargetActor->ActorHasTag(TEXT("red_cone")))
 		{
 			PerceivedRedCone = nullptr;
-			UE_LOG(LogTemp, Warning, TEXT("Foreman: Lost sight of red cone"));
+			WYTCH_EVENT(Perception, Trace, TEXT("Lost sight of red cone"));
 		}
 		return;
 	}
 
-	// Target detected
-	GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Green,
-		FString::Printf(TEXT("DETECTED: %s"), *TargetActor->GetName()));
-
 	// Track red_cone specifically
 	if (TargetActor->ActorHasTag(TEXT("red_cone")))
 	{
 		PerceivedRedCone = TargetActor;
-		UE_LOG(LogTemp, Warning, TEXT("Foreman: *** RED CONE DETECTED ***"));
-		GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Red,
-			TEXT("*** RED CONE DETECTED ***"));
+		WYTCH_EVENT(Perception, Info, TEXT("Red cone detected"));
 	}
 
 	// Always add to perceived actors list for LLM context
@@ -799,20 +929,9 @@ void UForeman_BrainComponent::OnTargetPerceptionUpdated(
 
 AActor* UForeman_BrainComponent::FindActorByTag(const FString& Tag)
 {
-	for (AActor* Actor : LastPerceivedActors)
-	{
-		if (!Actor) continue;
-		FString ActorTag = Actor->Tags.Num() > 0 ?
-			Actor->Tags[0].ToString() : Actor->GetName();
-		if (ActorTag.Equals(Tag, ESearchCase::IgnoreCase))
-			return Actor;
-	}
-
-	// Fallback - search whole world
-	TArray<AActor*> AllActors;
-	UGameplayStatics::GetAllActorsWithTag(
-		GetWorld(), FName(*Tag), AllActors);
-	return AllActors.Num() > 0 ? AllActors[0] : nullptr;
+	// Only actors the model was actually shown are valid targets
+	const TWeakObjectPtr<AActor>* Found = PerceivedTagIndex.Find(Tag);
+	return Found ? Found->Get() : nullptr;
 }
 
 AForeman_AIController* UForeman_BrainComponent::GetForemanController()
@@ -866,17 +985,28 @@ FString UForeman_BrainComponent::RenderTargetToBase64()
 	if (!RT) return FString();
 
 	TArray<FColor> Pixels;
-	if (!RT->ReadPixels(Pixels)) return FString();
-
-	IImageWrapperModule& IWM =
-		FModuleManager::LoadModuleChecked<IImageWrapperModule>(
-			FName("ImageWrapper"));
-	TSharedPtr<IImageWrapper> IW =
-		IWM.CreateImageWrapper(EImageFormat::PNG);
-	IW->SetRaw(Pixels.GetData(), Pixels.GetAllocatedSize(),
-		RenderTarget->SizeX, RenderTarget->SizeY,
-		ERGBFormat::BGRA, 8);
-	TArray64<uint8> PNG = IW->GetCompressed(0);
+	{
+		WYTCH_SCOPE(STAT_WytchBrainReadback);
+		if (!RT->ReadPixels(Pixels)) return FString();
+	}
+	FWytchLatencyStats::Record(EWytchLatencyStage::BrainCapture, FPlatformTime::Seconds() - SnapStartSeconds);
+	FWytchLatencyTimer EncodeTimer(EWytchLatencyStage::BrainEncode);
+
+	TArray64<uint8> PNG;
+	{
+		WYTCH_SCOPE(STAT_WytchBrainEncode);
+		IImageWrapperModule& IWM =
+			FModuleManager::LoadModuleChecked<IImageWrapperModule>(
+				FName("ImageWrapper"));
+		TSharedPtr<IImageWrapper> IW =
+			IWM.CreateImageWrapper(EImageFormat::PNG);
+		IW->SetRaw(Pixels.GetData(), Pixels.GetAllocatedSize(),
+			RenderTarget->SizeX, RenderTarget->SizeY,
+			ERGBFormat::BGRA, 8);
+		PNG = IW->GetCompressed(0);
+	}
+
+	WYTCH_SCOPE(STAT_WytchBrainBase64);
 	return FBase64::Encode(PNG.GetData(), PNG.Num());
 }
 
@@ -2,14 +2,16 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
-#include "HttpModule.h"
-#include "Interfaces/IHttpRequest.h"
-#include "Interfaces/IHttpResponse.h"
 #include "Perception/AIPerceptionComponent.h"
 #include "Components/SceneCaptureComponent2D.h"
 #include "Engine/TextureRenderTarget2D.h"
+#include "WytchingStats.h"
+#include "WytchLLMBackend.h"
 #include "Foreman_BrainComponent.generated.h"
 
+class FWytchRecordingLLMBackend;
+class FWytchReplayLLMBackend;
+
 UENUM()
 enum class EForemanState : uint8
 {
@@ -43,6 +45,26 @@ public:
 	void ShutdownBoot();
 	bool IsBooted() const { return bBooted; }
 
+	EForemanState GetState() const { return CurrentState; }
+
+	/** Swaps the LLM backend (mock, replay). Null restores IWytchLLMBackend::CreateDefault. */
+	void SetLLMBackend(TSharedPtr<IWytchLLMBackend> InBackend);
+	TSharedPtr<IWytchLLMBackend> GetLLMBackend() const { return LLMBackend; }
+
+	/** Wraps the current backend and writes every snap to a session file (WytchBrainSession.h). */
+	bool StartRecording(const FString& Path);
+	void StopRecording();
+
+	/**
+	 * Answers snaps from a recorded session instead of a backend. Each recorded
+	 * command is re-issued when the session reaches the first snap taken under it;
+	 * once the session runs out, replay ends and the brain goes Idle. TimeScale
+	 * scales both recorded latency and SnapInterval (1 = recorded timing, 0 = every tick).
+	 */
+	bool StartReplay(const FString& Path, float TimeScale = 1.f);
+	void StopReplay();
+	bool IsReplaying() const { return ReplayBackend.IsValid(); }
+
 private:
 	// State
 	EForemanState CurrentState;
@@ -56,6 +78,14 @@ private:
 	UPROPERTY()
 	TArray<AActor*> LastPerceivedActors;
 
+	// Tag -> actor for exactly the set emitted in the last perception context.
+	// FString keys hash and compare case-insensitively, so this is the
+	// case-folded lookup the LLM's target_tag is resolved against.
+	TMap<FString, TWeakObjectPtr<AActor>> PerceivedTagIndex;
+
+	// Actor resolved from TargetActorTag when navigation started
+	TWeakObjectPtr<AActor> NavigationTarget;
+
 	// Perception tracking
 	UPROPERTY()
 	AActor* PerceivedRedCone = nullptr;
@@ -75,6 +105,13 @@ private:
 	float LookAroundTimer;
 	int32 LookAroundSnapsCount;
 	bool bWaitingForLLMResponse;
+
+	/** Insights regions for the in-flight snap. */
+	FWytchLLMTrace LLMTrace;
+
+	/** FPlatformTime stamps for the latency histograms (capture start, request sent). */
+	double SnapStartSeconds = 0.0;
+	double RequestSentSeconds = 0.0;
 	float InitialForwardYaw;
 	bool bSavedUseControllerDesiredRotation;
 	bool bSavedOrientRotationToMovement;
@@ -88,15 +125,20 @@ private:
 	UPROPERTY(EditAnywhere, Category="Foreman")
 	FString LMStudioURL;
 
+	TSharedPtr<IWytchLLMBackend> LLMBackend;
+
+	// Session record / replay
+	TSharedPtr<FWytchRecordingLLMBackend> RecordingBackend;
+	TSharedPtr<FWytchReplayLLMBackend> ReplayBackend;
+	float SnapIntervalScale = 1.f;
+
 	// Vision
 	bool InitialiseComponents();
 	void SnapAndAnalyse();
 	FString RenderTargetToBase64();
 	FString BuildPerceptionContext();
 	void SendToLLM(const FString& Base64, const FString& Context);
-	void OnLLMResponse(FHttpRequestPtr Request,
-		FHttpResponsePtr Response,
-		bool bWasSuccessful);
+	void OnLLMResponse(const FWytchLLMResponse& Response);
 	FString SanitizeJson(const FString& Raw);
 
 	// Action execution
@@ -109,6 +151,9 @@ private:
 	void TickLookAround(float DeltaTime);
 	void TickNavigating(float DeltaTime);
 
+	/** Follows the replayed session's command changes and ends replay when it runs out. */
+	void TickReplay();
+
 	// Perception
 	void ConfigurePerceptionSenses();
 
@@ -7,6 +7,13 @@
 #include "AndroidTypes.h"
 #include "IWytchCommandable.generated.h"
 
+/**
+ * Fired by a worker when its effective EWorkerState changes.
+ * OldState == NewState signals a capability change with no state change.
+ */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnWytchWorkerStateChanged,
+	AActor* /*Worker*/, EWorkerState /*OldState*/, EWorkerState /*NewState*/);
+
 UINTERFACE(MinimalAPI, Blueprintable)
 class UWytchCommandable : public UInterface
 {
@@ -42,7 +49,25 @@ public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Wytch|Command")
 	FGameplayTagContainer GetCapabilities() const;
 
+	/**
+	 * Foreman calls this while the worker is still working to reserve its next
+	 * SmartObject task. On finishing the current work the worker heads straight
+	 * for it instead of going Idle. Returns false if the worker cannot take a
+	 * follow-up (not working, one already queued) — the Foreman releases the job.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Wytch|Command")
+	bool QueueFollowUpAssignment(
+		FSmartObjectSlotHandle SlotHandle,
+		AActor* TargetActor);
+
 	/** Foreman calls this to abort the worker's current task. */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Wytch|Command")
 	void AbortCurrentTask(EAbortReason Reason);
+
+	/**
+	 * C++ only. Workers that broadcast their state changes return their delegate
+	 * so the Foreman roster can track them without polling GetWorkerState.
+	 * nullptr (the default, and every Blueprint-only implementer) = roster polls.
+	 */
+	virtual FOnWytchWorkerStateChanged* GetWorkerStateChangedDelegate() { return nullptr; }
 };
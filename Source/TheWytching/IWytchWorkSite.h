@@ -19,6 +19,7 @@ class UWytchWorkSite : public UWytchInteractable
  * Claiming is handled by SmartObjects (USmartObjectSubsystem).
  * This interface defines WHAT HAPPENS during the work interaction:
  *   SmartObject gets the worker there → BeginWork → TickWork → EndWork
+ * Progress and TickWork dispatch are batched across all sites in UWytchWorkSessionSubsystem.
  */
 class THEWYTCHING_API IWytchWorkSite : public IWytchInteractable
 {
@@ -37,10 +38,17 @@ public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Wytch|WorkSite")
 	bool BeginWork(AActor* Worker);
 
-	/** Called each tick during work (progress bars, animations, etc.). */
+	/**
+	 * Called during work by UWytchWorkSessionSubsystem — every frame if WantsWorkTick,
+	 * otherwise only at progress milestones, with DeltaTime covering the time since the last call.
+	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Wytch|WorkSite")
 	void TickWork(AActor* Worker, float DeltaTime);
 
+	/** Opt in to per-frame TickWork (live progress bars, continuous effects). Default false = milestones only. */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Wytch|WorkSite")
+	bool WantsWorkTick() const;
+
 	/** End interaction. Called on completion, abort, or failure. */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Wytch|WorkSite")
 	void EndWork(AActor* Worker, EWorkEndReason Reason);
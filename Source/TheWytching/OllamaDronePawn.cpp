@@ -17,6 +17,8 @@
 #include "GameFramework/Controller.h"
 #include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/ScopeExit.h"
+#include "WytchEventLog.h"
 
 namespace OllamaDroneJson
 {
@@ -117,20 +119,14 @@ void AOllamaDronePawn::BeginPlay()
 	APlayerController* PC = Cast<APlayerController>(Controller);
 	if (PC)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Drone: Possessed by PlayerController ✓"));
-		GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Green,
-			TEXT("Drone Possessed by PlayerController ✓"));
+		WYTCH_EVENT(Drone, Info, TEXT("Possessed by PlayerController"));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Error, TEXT("Drone: NOT possessed by PlayerController ✗"));
-		GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Red,
-			TEXT("Drone NOT possessed by PlayerController ✗ - Check GameMode!"));
+		WYTCH_EVENT(Drone, Error, TEXT("NOT possessed by PlayerController - check GameMode"));
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Drone: Ready. WASD to move, QE for height, F to snap."));
-	GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Yellow,
-		TEXT("Drone Ready — F to snap and send to LMStudio"));
+	WYTCH_EVENT(Drone, Info, TEXT("Ready. WASD to move, QE for height, F to snap and send to LMStudio"));
 }
 
 void AOllamaDronePawn::Tick(float DeltaTime)
@@ -166,14 +162,10 @@ void AOllamaDronePawn::SetupPlayerInputComponent(
 
 	if (!PlayerInputComponent)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Drone: PlayerInputComponent is NULL!"));
-		GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Red,
-			TEXT("ERROR: PlayerInputComponent is NULL"));
+		WYTCH_EVENT(Drone, Error, TEXT("PlayerInputComponent is NULL"));
 		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Drone: Binding input axes..."));
-
 	PlayerInputComponent->BindAxis("MoveForward", this,
 		&AOllamaDronePawn::MoveForward);
 	PlayerInputComponent->BindAxis("MoveRight", this,
@@ -191,16 +183,14 @@ void AOllamaDronePawn::SetupPlayerInputComponent(
 	PlayerInputComponent->BindAction("IssueForemanCommand", IE_Pressed, this,
 		&AOllamaDronePawn::IssueFormanCommand);
 
-	UE_LOG(LogTemp, Warning, TEXT("Drone: Input bindings complete ✓"));
-	GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Green,
-		TEXT("Drone Input Bindings Complete ✓"));
+	WYTCH_EVENT(Drone, Trace, TEXT("Input bindings complete"));
 }
 
 void AOllamaDronePawn::MoveForward(float Value)
 {
 	if (FMath::Abs(Value) > 0.1f)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Drone: MoveForward = %f"), Value);
+		WYTCH_EVENT(Drone, Trace, TEXT("MoveForward = %f"), Value);
 	}
 	MovementInput.X = FMath::Clamp(Value, -1.f, 1.f);
 }
@@ -209,7 +199,7 @@ void AOllamaDronePawn::MoveRight(float Value)
 {
 	if (FMath::Abs(Value) > 0.1f)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Drone: MoveRight = %f"), Value);
+		WYTCH_EVENT(Drone, Trace, TEXT("MoveRight = %f"), Value);
 	}
 	MovementInput.Y = FMath::Clamp(Value, -1.f, 1.f);
 }
@@ -218,7 +208,7 @@ void AOllamaDronePawn::MoveUp(float Value)
 {
 	if (FMath::Abs(Value) > 0.1f)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Drone: MoveUp = %f"), Value);
+		WYTCH_EVENT(Drone, Trace, TEXT("MoveUp = %f"), Value);
 	}
 	MovementInput.Z = FMath::Clamp(Value, -1.f, 1.f);
 }
@@ -227,7 +217,7 @@ void AOllamaDronePawn::Turn(float Value)
 {
 	if (FMath::Abs(Value) > 0.1f)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Drone: Turn = %f"), Value);
+		WYTCH_EVENT(Drone, Trace, TEXT("Turn = %f"), Value);
 	}
 	AddControllerYawInput(Value * LookSensitivity);
 }
@@ -236,29 +226,39 @@ void AOllamaDronePawn::LookUp(float Value)
 {
 	if (FMath::Abs(Value) > 0.1f)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Drone: LookUp = %f"), Value);
+		WYTCH_EVENT(Drone, Trace, TEXT("LookUp = %f"), Value);
 	}
 	AddControllerPitchInput(Value * LookSensitivity);
 }
 
 void AOllamaDronePawn::SnapAndSend()
 {
-	GEngine->AddOnScreenDebugMessage(-1, 3.f, FColor::Yellow,
-		TEXT("Drone: Snapping..."));
+	WYTCH_SCOPE(STAT_WytchBrainSnap);
+
+	WYTCH_EVENT(Drone, Trace, TEXT("Snapping..."));
 
-	SceneCapture->CaptureScene();
+	LLMTrace.BeginRoundTrip(TEXT("Drone"));
+	{
+		WYTCH_SCOPE(STAT_WytchBrainCapture);
+		SceneCapture->CaptureScene();
+	}
 	FString Base64 = RenderTargetToBase64(RenderTarget);
 
 	if (Base64.IsEmpty())
 	{
-		UE_LOG(LogTemp, Error, TEXT("Drone: Capture failed"));
+		WYTCH_EVENT(Drone, Error, TEXT("Capture failed"));
+		LLMTrace.EndRoundTrip();
 		return;
 	}
 
 	// Build perception context
-	const FString Context = BuildPerceptionContext();
+	FString Context;
+	{
+		WYTCH_SCOPE(STAT_WytchBrainContext);
+		Context = BuildPerceptionContext();
+	}
 	
-	UE_LOG(LogTemp, Warning, TEXT("Drone Perception Context: %s"), *Context);
+	WYTCH_EVENT(Drone, Trace, TEXT("Perception context: %s"), *Context);
 
 	// Send to LMStudio
 	SendImageToLLM(Base64, Context);
@@ -275,31 +275,38 @@ FString AOllamaDronePawn::RenderTargetToBase64(UTextureRenderTarget2D* Target)
 	if (!RT) return FString();
 
 	TArray<FColor> Pixels;
-	if (!RT->ReadPixels(Pixels)) return FString();
+	{
+		WYTCH_SCOPE(STAT_WytchBrainReadback);
+		if (!RT->ReadPixels(Pixels)) return FString();
+	}
 
 	int32 Width = Target->SizeX;
 	int32 Height = Target->SizeY;
 
-	IImageWrapperModule& ImageWrapperModule =
-		FModuleManager::LoadModuleChecked<IImageWrapperModule>(
-			FName("ImageWrapper"));
-	TSharedPtr<IImageWrapper> ImageWrapper =
-		ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
-
-	ImageWrapper->SetRaw(Pixels.GetData(),
-		Pixels.GetAllocatedSize(), Width, Height,
-		ERGBFormat::BGRA, 8);
+	TArray64<uint8> PNGData;
+	{
+		WYTCH_SCOPE(STAT_WytchBrainEncode);
+		IImageWrapperModule& ImageWrapperModule =
+			FModuleManager::LoadModuleChecked<IImageWrapperModule>(
+				FName("ImageWrapper"));
+		TSharedPtr<IImageWrapper> ImageWrapper =
+			ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
+
+		ImageWrapper->SetRaw(Pixels.GetData(),
+			Pixels.GetAllocatedSize(), Width, Height,
+			ERGBFormat::BGRA, 8);
+
+		PNGData = ImageWrapper->GetCompressed(0);
+	}
 
-	TArray64<uint8> PNGData = ImageWrapper->GetCompressed(0);
+	WYTCH_SCOPE(STAT_WytchBrainBase64);
 	return FBase64::Encode(PNGData.GetData(), PNGData.Num());
 }
 
 FString AOllamaDronePawn::BuildPerceptionContext()
 {
-	// Clear and populate perception cache
-	LastPerceivedActors.Empty();
-	PerceptionComponent->GetCurrentlyPerceivedActors(
-		UAISense_Sight::StaticClass(), LastPerceivedActors);
+	// Perception cache is rebuilt from the visible set below
+	PerceivedTagIndex.Reset();
 
 	TArray<AActor*> PerceivedActors;
 	PerceptionComponent->GetCurrentlyPerceivedActors(
@@ -329,6 +336,8 @@ FString AOllamaDronePawn::BuildPerceptionContext()
 			Tag.Contains("Wall"))
 			continue;
 
+		PerceivedTagIndex.FindOrAdd(Tag, Actor);
+
 		FVector ActorLoc = Actor->GetActorLocation();
 		FVector DroneLoc = GetActorLocation();
 		float Distance = FVector::Dist(DroneLoc, ActorLoc);
@@ -595,6 +604,8 @@ float AOllamaDronePawn::TraceDistance(const FVector& Direction,
 void AOllamaDronePawn::SendImageToLLM(const FString& Base64Image,
                                      const FString& ContextText)
 {
+	WYTCH_SCOPE(STAT_WytchBrainSend);
+
 	FHttpRequestRef Request = FHttpModule::Get().CreateRequest();
 	Request->SetURL(TEXT("http://localhost:1234/v1/chat/completions"));
 	Request->SetVerb(TEXT("POST"));
@@ -634,9 +645,9 @@ void AOllamaDronePawn::SendImageToLLM(const FString& Base64Image,
 	Request->OnProcessRequestComplete().BindUObject(this,
 		&AOllamaDronePawn::OnResponseReceived);
 	Request->ProcessRequest();
+	LLMTrace.BeginNetwork();
 
-	GEngine->AddOnScreenDebugMessage(-1, 3.f, FColor::Yellow,
-		TEXT("Drone: Sent to LMStudio, waiting..."));
+	WYTCH_EVENT(Drone, Info, TEXT("Sent to LMStudio, waiting..."));
 }
 
 FString AOllamaDronePawn::SanitizeJson(const FString& Raw)
@@ -662,49 +673,34 @@ FString AOllamaDronePawn::SanitizeJson(const FString& Raw)
 void AOllamaDronePawn::ExecuteAction(const FString& Action, 
                                      const FString& Target)
 {
-	UE_LOG(LogTemp, Warning, TEXT("Executing: %s -> %s"), 
-		*Action, *Target);
+	WYTCH_SCOPE(STAT_WytchBrainAction);
+
+	WYTCH_EVENT(Drone, Trace, TEXT("Executing: %s -> %s"), *Action, *Target);
 
 	// Find target actor in perception cache
-	AActor* TargetActor = nullptr;
-	for (AActor* Actor : LastPerceivedActors)
-	{
-		if (!Actor) continue;
-		FString Tag = Actor->Tags.Num() > 0 ?
-			Actor->Tags[0].ToString() : Actor->GetName();
-		if (Tag.Equals(Target, ESearchCase::IgnoreCase))
-		{
-			TargetActor = Actor;
-			break;
-		}
-	}
+	const TWeakObjectPtr<AActor>* Cached = PerceivedTagIndex.Find(Target);
+	AActor* TargetActor = Cached ? Cached->Get() : nullptr;
 
 	if (!TargetActor)
 	{
-		UE_LOG(LogTemp, Warning, 
-			TEXT("ExecuteAction: Target '%s' not in perception cache"),
+		WYTCH_EVENT(Drone, Warning,
+			TEXT("Target not visible: '%s' not in perception cache"),
 			*Target);
-		GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Orange,
-			FString::Printf(TEXT("Target not visible: %s"), *Target));
 		return;
 	}
 
 	FVector TargetPos = TargetActor->GetActorLocation();
 
-	GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Green,
-		FString::Printf(TEXT("Action: %s -> %s at [%.0f, %.0f, %.0f]"),
-			*Action, *Target, 
-			TargetPos.X, TargetPos.Y, TargetPos.Z));
-
 	// Log confirmed position for next phase
-	UE_LOG(LogTemp, Warning, 
-		TEXT("Target resolved: %s at %s"), 
-		*Target, *TargetPos.ToString());
+	WYTCH_EVENT(Drone, Info, TEXT("Action: %s -> %s at [%.0f, %.0f, %.0f]"),
+		*Action, *Target, TargetPos.X, TargetPos.Y, TargetPos.Z);
 }
 
 void AOllamaDronePawn::SendImageToGemini(const FString& Base64Image,
                                          const FString& ContextText)
 {
+	WYTCH_SCOPE(STAT_WytchBrainSend);
+
 	FHttpRequestRef Request = FHttpModule::Get().CreateRequest();
 	
 	// Gemini API key
@@ -746,24 +742,27 @@ void AOllamaDronePawn::SendImageToGemini(const FString& Base64Image,
 	Request->OnProcessRequestComplete().BindUObject(this,
 		&AOllamaDronePawn::OnGeminiResponseReceived);
 	Request->ProcessRequest();
+	LLMTrace.BeginNetwork();
 
-	GEngine->AddOnScreenDebugMessage(-1, 3.f, FColor::Yellow,
-		TEXT("Drone: Sent to Gemini, waiting..."));
+	WYTCH_EVENT(Drone, Info, TEXT("Sent to Gemini, waiting..."));
 }
 
 void AOllamaDronePawn::OnResponseReceived(FHttpRequestPtr Request,
                                           FHttpResponsePtr Response,
                                           bool bWasSuccessful)
 {
+	LLMTrace.EndNetwork();
+	ON_SCOPE_EXIT { LLMTrace.EndRoundTrip(); };
+	WYTCH_SCOPE(STAT_WytchBrainParse);
+
 	if (!bWasSuccessful || !Response.IsValid())
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Red,
-			TEXT("Drone: LMStudio connection failed"));
+		WYTCH_EVENT(Drone, Error, TEXT("LMStudio connection failed"));
 		return;
 	}
 
 	FString Raw = Response->GetContentAsString();
-	UE_LOG(LogTemp, Warning, TEXT("Raw Response: %s"), *Raw);
+	WYTCH_EVENT(Drone, Trace, TEXT("Raw response: %s"), *Raw);
 
 	TSharedPtr<FJsonObject> JsonObject;
 	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Raw);
@@ -781,8 +780,7 @@ void AOllamaDronePawn::OnResponseReceived(FHttpRequestPtr Request,
 			// Sanitize JSON before parsing
 			Content = SanitizeJson(Content);
 
-			// Log full response
-			UE_LOG(LogTemp, Warning, TEXT("Drone Vision Response: %s"), *Content);
+			WYTCH_EVENT(Drone, Trace, TEXT("Vision response: %s"), *Content);
 
 			// Parse the LLM's JSON response
 			TSharedPtr<FJsonObject> LLMJson;
@@ -804,16 +802,10 @@ void AOllamaDronePawn::OnResponseReceived(FHttpRequestPtr Request,
 				TArray<TSharedPtr<FJsonValue>> TaggedActors = LLMJson->GetArrayField(TEXT("tagged_actors"));
 				int32 ActorCount = TaggedActors.Num();
 
-				// Display summary on screen
-				GEngine->AddOnScreenDebugMessage(-1, 15.f, FColor::Cyan,
-					FString::Printf(TEXT("📷 Summary: %s"), *Summary));
-				
-				GEngine->AddOnScreenDebugMessage(-1, 15.f, FColor::Green,
-					FString::Printf(TEXT("🎯 Action: %s | Target: %s | Dir: %s | Speed: %s"), 
-						*Action, *Target, *Direction, *Speed));
-				
-				GEngine->AddOnScreenDebugMessage(-1, 15.f, FColor::Yellow,
-					FString::Printf(TEXT("📍 Detected %d nearby actors"), ActorCount));
+				WYTCH_EVENT(Drone, Info, TEXT("Summary: %s"), *Summary);
+				WYTCH_EVENT(Drone, Info, TEXT("Action: %s | Target: %s | Dir: %s | Speed: %s"),
+					*Action, *Target, *Direction, *Speed);
+				WYTCH_EVENT(Drone, Trace, TEXT("Detected %d nearby actors"), ActorCount);
 
 				// Execute the action
 				if (!Action.IsEmpty() && !Target.IsEmpty())
@@ -830,15 +822,14 @@ void AOllamaDronePawn::OnResponseReceived(FHttpRequestPtr Request,
 						FString Tag = ActorObj->GetStringField(TEXT("tag"));
 						float Distance = ActorObj->GetNumberField(TEXT("distance"));
 						
-						UE_LOG(LogTemp, Log, TEXT("  - %s at %.1f units"), *Tag, Distance);
+						WYTCH_EVENT(Drone, Trace, TEXT("  - %s at %.1f units"), *Tag, Distance);
 					}
 				}
 			}
 			else
 			{
 				// Fallback if JSON parsing fails
-				GEngine->AddOnScreenDebugMessage(-1, 20.f, FColor::Orange,
-					FString::Printf(TEXT("👁 %s"), *Content));
+				WYTCH_EVENT(Drone, Warning, TEXT("Unparsed response: %s"), *Content);
 			}
 		}
 	}
@@ -848,15 +839,18 @@ void AOllamaDronePawn::OnGeminiResponseReceived(FHttpRequestPtr Request,
                                                 FHttpResponsePtr Response,
                                                 bool bWasSuccessful)
 {
+	LLMTrace.EndNetwork();
+	ON_SCOPE_EXIT { LLMTrace.EndRoundTrip(); };
+	WYTCH_SCOPE(STAT_WytchBrainParse);
+
 	if (!bWasSuccessful || !Response.IsValid())
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 10.f, FColor::Red,
-			TEXT("Drone: Gemini connection failed"));
+		WYTCH_EVENT(Drone, Error, TEXT("Gemini connection failed"));
 		return;
 	}
 
 	FString Raw = Response->GetContentAsString();
-	UE_LOG(LogTemp, Warning, TEXT("Gemini Raw Response: %s"), *Raw);
+	WYTCH_EVENT(Drone, Trace, TEXT("Gemini raw response: %s"), *Raw);
 
 	TSharedPtr<FJsonObject> JsonObject;
 	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Raw);
@@ -879,13 +873,7 @@ void AOllamaDronePawn::OnGeminiResponseReceived(FHttpRequestPtr Request,
 			Content.ReplaceInline(TEXT("```"), TEXT(""));
 			Content.TrimStartAndEndInline();
 
-			UE_LOG(LogTemp, Warning, TEXT("Gemini Vision Response: %s"), *Content);
-
-			// Display on HUD in light green with wrapping
-			// Light green color
-			FColor LightGreen(144, 238, 144);
-			
-			// Split into lines for wrapping (max ~80 chars per line for readability)
+			// Split into lines so each fits one event record (max ~80 chars per line)
 			TArray<FString> Lines;
 			const int32 MaxCharsPerLine = 80;
 			
@@ -919,10 +907,10 @@ void AOllamaDronePawn::OnGeminiResponseReceived(FHttpRequestPtr Request,
 			
 			Lines.Add(TEXT("======================"));
 			
-			// Display all lines on screen (reverse order so they appear top-down)
+			// On-screen messages stack newest on top — emit bottom-up so the block reads top-down
 			for (int32 i = Lines.Num() - 1; i >= 0; --i)
 			{
-				GEngine->AddOnScreenDebugMessage(-1, 30.f, LightGreen, Lines[i]);
+				WYTCH_EVENT(Drone, Info, TEXT("%s"), *Lines[i]);
 			}
 		}
 	}
@@ -956,12 +944,10 @@ void AOllamaDronePawn::IssueFormanCommand()
 		{
 			Brain->IssueCommand(
 				TEXT("find the red_cone and place it at 0,0,0"));
-			GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Cyan,
-				TEXT("Drone: Command issued to Kellan"));
+			WYTCH_EVENT(Drone, Info, TEXT("Command issued to Kellan"));
 			return;
 		}
 	}
-	GEngine->AddOnScreenDebugMessage(-1, 5.f, FColor::Red,
-		TEXT("Drone: Kellan not found in level"));
+	WYTCH_EVENT(Drone, Warning, TEXT("Kellan not found in level"));
 }
 
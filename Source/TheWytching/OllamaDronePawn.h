@@ -10,6 +10,7 @@
 #include "Interfaces/IHttpResponse.h"
 #include "Perception/AIPerceptionComponent.h"
 #include "Perception/AISenseConfig_Sight.h"
+#include "WytchingStats.h"
 #include "OllamaDronePawn.generated.h"
 
 UCLASS()
@@ -48,9 +49,12 @@ private:
 	// UPROPERTY()
 	// UTextureRenderTarget2D* TopDownRenderTarget;
 
-	// Perception cache
-	UPROPERTY()
-	TArray<AActor*> LastPerceivedActors;
+	// Perception cache: tag -> actor for the currently_visible set sent to
+	// the LLM. FString keys hash case-insensitively.
+	TMap<FString, TWeakObjectPtr<AActor>> PerceivedTagIndex;
+
+	/** Insights regions for the in-flight snap. */
+	FWytchLLMTrace LLMTrace;
 
 	// Movement
 	void MoveForward(float Value);
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// ─────────────────────────────────────────────────────────
+// Shared helpers for the TheWytching automation suite
+//   Run headless:
+//     UnrealEditor-Cmd TheWytching.uproject -game -nullrhi -unattended -WytchMockLLM
+//       -ExecCmds="Automation RunTests TheWytching; Quit"
+// ─────────────────────────────────────────────────────────
+
+/** Latent wait until Predicate holds. Adds an error to Test and moves on after TimeoutSeconds. */
+class FWytchWaitUntilCommand : public IAutomationLatentCommand
+{
+public:
+	FWytchWaitUntilCommand(FAutomationTestBase* InTest, const TCHAR* InWhat, double InTimeoutSeconds, TFunction<bool()> InPredicate)
+		: Test(InTest)
+		, What(InWhat)
+		, TimeoutSeconds(InTimeoutSeconds)
+		, Predicate(MoveTemp(InPredicate))
+	{
+	}
+
+	virtual bool Update() override
+	{
+		if (Predicate())
+		{
+			return true;
+		}
+		if (GetCurrentRunTime() > TimeoutSeconds)
+		{
+			Test->AddError(FString::Printf(TEXT("Timed out after %.0fs waiting for %s"), TimeoutSeconds, *What));
+			return true;
+		}
+		return false;
+	}
+
+private:
+	FAutomationTestBase* Test;
+	FString What;
+	double TimeoutSeconds;
+	TFunction<bool()> Predicate;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
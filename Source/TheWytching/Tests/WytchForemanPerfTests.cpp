@@ -0,0 +1,196 @@
+#include "WytchAutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/AutomationCommon.h"
+#include "Algo/Find.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "WytchDispatchScenario.h"
+#include "WytchLatencyStats.h"
+
+// ─────────────────────────────────────────────────────────
+// TheWytching.Perf.Dispatch.<Case>
+//   Spawns a scenario, warms up, then measures frames/s, jobs
+//   completed per (game) minute and physical memory growth.
+//   Each run is appended to Saved/Automation/WytchPerf.csv and
+//   compared against PerfBaselines in
+//   [/Script/TheWytching.WytchDispatchScenarioSettings].
+// ─────────────────────────────────────────────────────────
+
+namespace WytchPerfTests
+{
+	struct FCase
+	{
+		const TCHAR* Name;
+		int32 NumForemen;
+		int32 NumWorkers;
+		int32 NumStations;
+	};
+
+	static const FCase Cases[] =
+	{
+		{ TEXT("Small"),  1,   8,  16 },
+		{ TEXT("Medium"), 2,  32,  64 },
+		{ TEXT("Large"),  4, 128, 256 },
+	};
+
+	static constexpr double WarmupSeconds = 10.0;
+	static constexpr double MeasureSeconds = 30.0;
+
+	struct FRun
+	{
+		FWytchDispatchScenario Scenario;
+		uint64 MemoryBefore = 0;
+		int32 Frames = 0;
+		double WallStart = 0.0;
+		double WorldStart = 0.0;
+		int32 CompletedStart = 0;
+	};
+
+	/** Counts frames until MeasureSeconds of wall time have passed. */
+	class FMeasureCommand : public IAutomationLatentCommand
+	{
+	public:
+		explicit FMeasureCommand(TSharedRef<FRun> InRun) : Run(InRun) {}
+
+		virtual bool Update() override
+		{
+			++Run->Frames;
+			return FPlatformTime::Seconds() - Run->WallStart >= MeasureSeconds;
+		}
+
+	private:
+		TSharedRef<FRun> Run;
+	};
+
+	static void AppendCsv(const FCase& Case, double FramesPerSecond, double JobsPerMinute, double MemoryGrowthMB)
+	{
+		const FString Path = FPaths::Combine(FPaths::AutomationDir(), TEXT("WytchPerf.csv"));
+		FString Line;
+		if (!IFileManager::Get().FileExists(*Path))
+		{
+			Line = TEXT("Build,Timestamp,Case,Foremen,Workers,Stations,FramesPerSecond,JobsPerMinute,MemoryGrowthMB\n");
+		}
+		Line += FString::Printf(TEXT("%s,%s,%s,%d,%d,%d,%.2f,%.2f,%.1f\n"),
+			FApp::GetBuildVersion(), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")), Case.Name,
+			Case.NumForemen, Case.NumWorkers, Case.NumStations, FramesPerSecond, JobsPerMinute, MemoryGrowthMB);
+
+		FFileHelper::SaveStringToFile(Line, *Path, FFileHelper::EEncodingOptions::AutoDetect,
+			&IFileManager::Get(), FILEWRITE_Append);
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FWytchDispatchPerfTest, "TheWytching.Perf.Dispatch",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FWytchDispatchPerfTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const WytchPerfTests::FCase& Case : WytchPerfTests::Cases)
+	{
+		OutBeautifiedNames.Add(Case.Name);
+		OutTestCommands.Add(Case.Name);
+	}
+}
+
+bool FWytchDispatchPerfTest::RunTest(const FString& Parameters)
+{
+	using namespace WytchPerfTests;
+
+	const FCase* Case = Algo::FindByPredicate(Cases, [&Parameters](const FCase& Candidate)
+	{
+		return Parameters.Equals(Candidate.Name);
+	});
+	if (!Case)
+	{
+		AddError(FString::Printf(TEXT("Unknown perf case '%s'"), *Parameters));
+		return false;
+	}
+
+	const UWytchDispatchScenarioSettings* Settings = GetDefault<UWytchDispatchScenarioSettings>();
+	AutomationOpenMap(Settings->TestMap.GetLongPackageName());
+
+	FWytchDispatchScenarioParams Params;
+	Params.Origin = Settings->TestOrigin;
+	Params.NumForemen = Case->NumForemen;
+	Params.NumWorkers = Case->NumWorkers;
+	Params.NumStations = Case->NumStations;
+
+	TSharedRef<FRun> Run = MakeShared<FRun>();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Run, Params]()
+	{
+		Run->MemoryBefore = FPlatformMemory::GetStats().UsedPhysical;
+		FString Error;
+		if (!Run->Scenario.Spawn(AutomationCommon::GetAnyGameWorld(), Params, Error))
+		{
+			AddError(FString::Printf(TEXT("Scenario spawn failed: %s"), *Error));
+		}
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FEngineWaitLatentCommand(WarmupSeconds));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([Run]()
+	{
+		Run->WallStart = FPlatformTime::Seconds();
+		Run->WorldStart = AutomationCommon::GetAnyGameWorld()->GetTimeSeconds();
+		Run->CompletedStart = Run->Scenario.GetJobStats().NumCompleted;
+		FWytchLatencyStats::ResetAll();
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FMeasureCommand(Run));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Run, Case, Settings]()
+	{
+		const double Wall = FMath::Max(FPlatformTime::Seconds() - Run->WallStart, UE_DOUBLE_SMALL_NUMBER);
+		const double GameMinutes = FMath::Max(AutomationCommon::GetAnyGameWorld()->GetTimeSeconds() - Run->WorldStart, 1.0) / 60.0;
+		const double FramesPerSecond = Run->Frames / Wall;
+		const double JobsPerMinute = (Run->Scenario.GetJobStats().NumCompleted - Run->CompletedStart) / GameMinutes;
+		const double MemoryGrowthMB =
+			(static_cast<double>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<double>(Run->MemoryBefore)) / (1024.0 * 1024.0);
+
+		AddInfo(FString::Printf(TEXT("%s: %.1f fps, %.1f jobs/min, %+.1f MB"), Case->Name, FramesPerSecond, JobsPerMinute, MemoryGrowthMB));
+		AppendCsv(*Case, FramesPerSecond, JobsPerMinute, MemoryGrowthMB);
+		FWytchLatencyStats::Dump();
+
+		const FWytchPerfBaseline* Baseline = Settings->FindBaseline(Case->Name);
+		if (Baseline && Baseline->MinFramesPerSecond <= 0.f && Baseline->MinJobsPerMinute <= 0.f && Baseline->MaxMemoryGrowthMB <= 0.f)
+		{
+			// A row that checks nothing would pass every run — make the missing numbers visible
+			AddError(FString::Printf(TEXT("Baseline for perf case %s checks nothing — fill it from WytchPerf.csv or remove the row"), Case->Name));
+		}
+		else if (Baseline)
+		{
+			const float Tolerance = Settings->PerfTolerance;
+			if (Baseline->MinFramesPerSecond > 0.f && FramesPerSecond < Baseline->MinFramesPerSecond * (1.f - Tolerance))
+			{
+				AddError(FString::Printf(TEXT("Frame rate regressed: %.1f fps vs baseline %.1f"), FramesPerSecond, Baseline->MinFramesPerSecond));
+			}
+			if (Baseline->MinJobsPerMinute > 0.f && JobsPerMinute < Baseline->MinJobsPerMinute * (1.f - Tolerance))
+			{
+				AddError(FString::Printf(TEXT("Dispatch throughput regressed: %.1f jobs/min vs baseline %.1f"), JobsPerMinute, Baseline->MinJobsPerMinute));
+			}
+			if (Baseline->MaxMemoryGrowthMB > 0.f && MemoryGrowthMB > Baseline->MaxMemoryGrowthMB * (1.f + Tolerance))
+			{
+				AddError(FString::Printf(TEXT("Memory regressed: %+.1f MB vs baseline %.1f MB"), MemoryGrowthMB, Baseline->MaxMemoryGrowthMB));
+			}
+		}
+		else
+		{
+			AddWarning(FString::Printf(TEXT("No baseline for perf case %s — recorded only"), Case->Name));
+		}
+
+		Run->Scenario.Destroy();
+		return true;
+	}));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
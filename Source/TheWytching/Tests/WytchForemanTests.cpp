@@ -0,0 +1,365 @@
+#include "WytchAutomationCommon.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Tests/AutomationCommon.h"
+#include "Foreman_AIController.h"
+#include "Foreman_BrainComponent.h"
+#include "ForemanRegistrySubsystem.h"
+#include "WytchBrainSession.h"
+#include "WytchCapabilityMask.h"
+#include "WytchDispatchScenario.h"
+#include "WytchLatencyStats.h"
+#include "WytchLLMBackend.h"
+#include "Json.h"
+#include "Misc/Base64.h"
+#include "Misc/Paths.h"
+
+// ─────────────────────────────────────────────────────────
+// Unit tests — no world needed
+// ─────────────────────────────────────────────────────────
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWytchLatencyHistogramTest, "TheWytching.Stats.LatencyHistogram",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWytchLatencyHistogramTest::RunTest(const FString& Parameters)
+{
+	TUniquePtr<FWytchLatencyHistogram> Histogram = MakeUnique<FWytchLatencyHistogram>();
+
+	// 1 ms … 1000 ms, uniform
+	for (int32 Ms = 1; Ms <= 1000; ++Ms)
+	{
+		Histogram->Record(Ms / 1000.0);
+	}
+
+	const FWytchLatencyHistogram::FSummary Summary = Histogram->Summarize();
+	TestEqual(TEXT("Count"), Summary.Count, uint64(1000));
+	TestEqual(TEXT("Max"), Summary.MaxSeconds, 1.0, 1e-6);
+	TestEqual(TEXT("Mean"), Summary.MeanSeconds, 0.5005, 1e-4);
+
+	// Log-linear buckets hold 16 per power of two — within 6.25% of the true value
+	TestEqual(TEXT("p50"), Summary.P50Seconds, 0.5, 0.5 * 0.0625);
+	TestEqual(TEXT("p90"), Summary.P90Seconds, 0.9, 0.9 * 0.0625);
+	TestEqual(TEXT("p99"), Summary.P99Seconds, 0.99, 0.99 * 0.0625);
+	TestTrue(TEXT("Percentiles ordered"),
+		Summary.P50Seconds <= Summary.P90Seconds && Summary.P90Seconds <= Summary.P99Seconds
+		&& Summary.P99Seconds <= Summary.MaxSeconds);
+
+	Histogram->Reset();
+	TestEqual(TEXT("Count after reset"), Histogram->Summarize().Count, uint64(0));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWytchMockLLMBackendTest, "TheWytching.Brain.MockBackend",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWytchMockLLMBackendTest::RunTest(const FString& Parameters)
+{
+	const FString Content = TEXT("{\"summary\":\"cone\",\"target_found\":true,\"target_tag\":\"RedCone\"}");
+
+	TSharedRef<FWytchMockLLMBackend> Mock = MakeShared<FWytchMockLLMBackend>();
+	Mock->Responder = [Content](const FWytchLLMRequest&) { return Content; };
+
+	TSharedRef<TOptional<FWytchLLMResponse>> Received = MakeShared<TOptional<FWytchLLMResponse>>();
+	FWytchLLMRequest Request;
+	Request.Body = TEXT("{}");
+	Mock->Send(Request, FOnWytchLLMResponse::CreateLambda([Received](const FWytchLLMResponse& Response)
+	{
+		*Received = Response;
+	}));
+
+	TestEqual(TEXT("Request counted"), Mock->GetNumRequests(), 1);
+	TestFalse(TEXT("Response is deferred, never re-entrant"), Received->IsSet());
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWytchWaitUntilCommand(this, TEXT("mock response"), 5.0, [this, Received, Content]()
+	{
+		if (!Received->IsSet()) return false;
+
+		const FWytchLLMResponse& Response = Received->GetValue();
+		TestTrue(TEXT("Success"), Response.bSuccess);
+
+		// Same shape the brain parses: choices[0].message.content
+		TSharedPtr<FJsonObject> Outer;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response.Content);
+		if (TestTrue(TEXT("Chat completion parses"), FJsonSerializer::Deserialize(Reader, Outer) && Outer.IsValid()))
+		{
+			const TArray<TSharedPtr<FJsonValue>>& Choices = Outer->GetArrayField(TEXT("choices"));
+			if (TestEqual(TEXT("One choice"), Choices.Num(), 1))
+			{
+				TestEqual(TEXT("Message content round-trips"),
+					Choices[0]->AsObject()->GetObjectField(TEXT("message"))->GetStringField(TEXT("content")), Content);
+			}
+		}
+		return true;
+	}));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWytchBrainSessionRoundTripTest, "TheWytching.Brain.SessionRoundTrip",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWytchBrainSessionRoundTripTest::RunTest(const FString& Parameters)
+{
+	const FString Path = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("SessionRoundTrip.wybs"));
+	const FString Content = TEXT("{\"summary\":\"cone\",\"target_found\":true,\"target_tag\":\"red_cone\"}");
+
+	TSharedRef<FWytchMockLLMBackend> Mock = MakeShared<FWytchMockLLMBackend>();
+	Mock->Responder = [Content](const FWytchLLMRequest&) { return Content; };
+	TSharedRef<FWytchRecordingLLMBackend> Recorder = MakeShared<FWytchRecordingLLMBackend>(Mock, Path);
+	if (!TestTrue(TEXT("Session file created"), Recorder->IsOpen()))
+	{
+		return false;
+	}
+
+	FWytchLLMRequest Request;
+	Request.Body = TEXT("{}");
+	Request.Command = TEXT("find the red cone");
+	Request.Context = TEXT("{\"currently_visible\":[]}");
+	Request.ImageBase64 = FBase64::Encode(TArray<uint8>({ 0x89, 'P', 'N', 'G' }));
+
+	TSharedRef<int32> NumReceived = MakeShared<int32>(0);
+	for (int32 Index = 0; Index < 2; ++Index)
+	{
+		Recorder->Send(Request, FOnWytchLLMResponse::CreateLambda([NumReceived](const FWytchLLMResponse&) { ++*NumReceived; }));
+	}
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWytchWaitUntilCommand(this, TEXT("recorded responses"), 5.0, [NumReceived]()
+	{
+		return *NumReceived == 2;
+	}));
+
+	TSharedRef<TOptional<FWytchLLMResponse>> Replayed = MakeShared<TOptional<FWytchLLMResponse>>();
+	TSharedRef<TSharedPtr<FWytchReplayLLMBackend>> Replay = MakeShared<TSharedPtr<FWytchReplayLLMBackend>>();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Recorder, Request, Path, Replayed, Replay]()
+	{
+		Recorder->Close();
+
+		FWytchBrainSession Session;
+		FString Error;
+		const bool bLoaded = FWytchBrainSession::Load(Path, Session, Error);
+		if (!TestTrue(FString::Printf(TEXT("Session loads %s"), *Error), bLoaded))
+		{
+			return true;
+		}
+		if (TestEqual(TEXT("Both snaps recorded"), Session.Snaps.Num(), 2))
+		{
+			const FWytchBrainSessionSnap& Snap = Session.Snaps[0];
+			TestEqual(TEXT("Command"), Snap.Command, Request.Command);
+			TestEqual(TEXT("Context"), Snap.Context, Request.Context);
+			TestEqual(TEXT("Image stored as bytes"), Snap.Image.Num(), 4);
+			TestTrue(TEXT("Success"), Snap.bSuccess);
+			TestTrue(TEXT("Raw response kept"), Snap.Response.Contains(TEXT("red_cone")));
+			TestTrue(TEXT("Timestamps ordered"), Snap.RequestSeconds <= Snap.ResponseSeconds);
+		}
+
+		*Replay = MakeShared<FWytchReplayLLMBackend>(MoveTemp(Session), 0.f);
+		FWytchLLMRequest Diverged = Request;
+		Diverged.Context = TEXT("{\"currently_visible\":[{\"tag\":\"other\"}]}");
+		(*Replay)->Send(Request, FOnWytchLLMResponse::CreateLambda([Replayed](const FWytchLLMResponse& Response) { *Replayed = Response; }));
+		(*Replay)->Send(Diverged, FOnWytchLLMResponse());
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWytchWaitUntilCommand(this, TEXT("replayed response"), 5.0, [this, Replayed, Replay]()
+	{
+		if (!Replayed->IsSet()) return false;
+
+		TestTrue(TEXT("Replay answers from the recording"), Replayed->GetValue().Content.Contains(TEXT("red_cone")));
+		TestTrue(TEXT("Replay consumed the session"), (*Replay)->IsFinished());
+		TestEqual(TEXT("Changed context flagged"), (*Replay)->GetNumDivergences(), 1);
+		return true;
+	}));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWytchCapabilityMatchTest, "TheWytching.Foreman.CapabilityMatch",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWytchCapabilityMatchTest::RunTest(const FString& Parameters)
+{
+	auto MakeTags = [](std::initializer_list<const TCHAR*> Names)
+	{
+		FGameplayTagContainer Tags;
+		for (const TCHAR* Name : Names)
+		{
+			Tags.AddTag(FGameplayTag::RequestGameplayTag(FName(Name)));
+		}
+		return Tags;
+	};
+
+	const FWytchCapabilityRegistry& Registry = FWytchCapabilityRegistry::Get();
+
+	// SOD_Build carries Task.Build on its slot
+	const FWytchCapabilityMask BuildSlot = Registry.MakeRequirementMask(MakeTags({ TEXT("Task.Build") }));
+	TestFalse(TEXT("Task.Build slot requires something"), BuildSlot.IsEmpty());
+
+	const FWytchCapabilityMask General = Registry.MakeWorkerMask(MakeTags({ TEXT("Capability.Hauling"), TEXT("Capability.Building") }));
+	const FWytchCapabilityMask Light = Registry.MakeWorkerMask(MakeTags({ TEXT("Task.Build"), TEXT("Task.Transport") }));
+	const FWytchCapabilityMask Scout = Registry.MakeWorkerMask(MakeTags({ TEXT("Task.Scout"), TEXT("Task.Recon") }));
+
+	TestTrue(TEXT("General worker takes a SOD_Build slot"), General.Covers(BuildSlot));
+	TestTrue(TEXT("Light AutoBot takes a SOD_Build slot"), Light.Covers(BuildSlot));
+	TestFalse(TEXT("Scout AutoBot does not take a SOD_Build slot"), Scout.Covers(BuildSlot));
+
+	// Child tasks inherit their parent's row; unlisted tasks need nothing
+	TestTrue(TEXT("Task.Carry.Heavy needs hauling"),
+		General.Covers(Registry.MakeRequirementMask(MakeTags({ TEXT("Task.Carry.Heavy") }))));
+	TestTrue(TEXT("Task.Idle needs no capability"),
+		Registry.MakeRequirementMask(MakeTags({ TEXT("Task.Idle") })).IsEmpty());
+	return true;
+}
+
+// ─────────────────────────────────────────────────────────
+// Functional tests — open the test map, spawn, drive the loop
+// ─────────────────────────────────────────────────────────
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWytchForemanDispatchLoopTest, "TheWytching.Foreman.DispatchLoop",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FWytchForemanDispatchLoopTest::RunTest(const FString& Parameters)
+{
+	const UWytchDispatchScenarioSettings* Settings = GetDefault<UWytchDispatchScenarioSettings>();
+	AutomationOpenMap(Settings->TestMap.GetLongPackageName());
+
+	FWytchDispatchScenarioParams Params;
+	Params.Origin = Settings->TestOrigin;
+	Params.NumWorkers = 6;
+	Params.NumStations = 8;
+
+	TSharedRef<FWytchDispatchScenario> Scenario = MakeShared<FWytchDispatchScenario>();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Scenario, Params]()
+	{
+		FString Error;
+		if (!Scenario->Spawn(AutomationCommon::GetAnyGameWorld(), Params, Error))
+		{
+			AddError(FString::Printf(TEXT("Scenario spawn failed: %s"), *Error));
+		}
+		return true;
+	}));
+
+	// Registry hands every worker to the Foreman (it may spawn a frame later)
+	ADD_LATENT_AUTOMATION_COMMAND(FWytchWaitUntilCommand(this, TEXT("workers registered"), 10.0, [Scenario]()
+	{
+		const TArray<AForeman_AIController*> Foremen = Scenario->GetForemen();
+		return Foremen.Num() > 0 && Foremen[0]->GetWorkerRoster().Num() >= Scenario->GetNumWorkers();
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Scenario]()
+	{
+		const UWorld* World = AutomationCommon::GetAnyGameWorld();
+		const UForemanRegistrySubsystem* Registry = UForemanRegistrySubsystem::Get(World);
+		const TArray<AForeman_AIController*> Foremen = Scenario->GetForemen();
+		for (AAutoBot_Character* Worker : Scenario->GetWorkers())
+		{
+			TestTrue(FString::Printf(TEXT("%s owned by the scenario Foreman"), *Worker->GetName()),
+				Registry && Foremen.Num() > 0 && Registry->GetOwningForeman(Worker) == Foremen[0]);
+		}
+		return true;
+	}));
+
+	// Plan → Assign → Monitor until every station has been worked once; invariants hold every frame
+	ADD_LATENT_AUTOMATION_COMMAND(FWytchWaitUntilCommand(this, TEXT("every station worked"), 180.0, [this, Scenario, Params]()
+	{
+		const FForemanJobQueueStats Stats = Scenario->GetJobStats();
+		if (Stats.NumAssigned > Scenario->GetNumWorkers())
+		{
+			AddError(FString::Printf(TEXT("%d jobs assigned to %d workers"), Stats.NumAssigned, Scenario->GetNumWorkers()));
+			return true;
+		}
+		if (Stats.NumCompleted > Stats.NumArrived || Stats.NumArrived > Stats.NumCreated)
+		{
+			AddError(FString::Printf(TEXT("Job counters out of order: created %d, arrived %d, completed %d"),
+				Stats.NumCreated, Stats.NumArrived, Stats.NumCompleted));
+			return true;
+		}
+		return Stats.NumCompleted >= Params.NumStations;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Scenario]()
+	{
+		const FForemanJobQueueStats Stats = Scenario->GetJobStats();
+		AddInfo(FString::Printf(TEXT("created %d, arrived %d, completed %d, chained %d, preempted %d, mean latency %.2fs"),
+			Stats.NumCreated, Stats.NumArrived, Stats.NumCompleted, Stats.NumChained, Stats.NumPreempted,
+			Stats.AverageLatencySeconds));
+		TestEqual(TEXT("No deadlines missed"), Stats.NumDeadlinesMissed, 0);
+		Scenario->Destroy();
+		return true;
+	}));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWytchForemanBrainMockScanTest, "TheWytching.Foreman.BrainMockScan",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::ProductFilter)
+
+bool FWytchForemanBrainMockScanTest::RunTest(const FString& Parameters)
+{
+	const UWytchDispatchScenarioSettings* Settings = GetDefault<UWytchDispatchScenarioSettings>();
+	AutomationOpenMap(Settings->TestMap.GetLongPackageName());
+
+	FWytchDispatchScenarioParams Params;
+	Params.Origin = Settings->TestOrigin;
+	Params.NumWorkers = 0;
+	Params.NumStations = 0;
+
+	TSharedRef<FWytchDispatchScenario> Scenario = MakeShared<FWytchDispatchScenario>();
+	TSharedRef<FWytchMockLLMBackend> Mock = MakeShared<FWytchMockLLMBackend>();
+	Mock->LatencySeconds = 0.05;
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Scenario, Params, Mock]()
+	{
+		FString Error;
+		if (!Scenario->Spawn(AutomationCommon::GetAnyGameWorld(), Params, Error))
+		{
+			AddError(FString::Printf(TEXT("Scenario spawn failed: %s"), *Error));
+			return true;
+		}
+		const TArray<AForeman_AIController*> Foremen = Scenario->GetForemen();
+		if (UForeman_BrainComponent* Brain = Foremen.Num() > 0 ? Foremen[0]->GetForemanBrain() : nullptr)
+		{
+			Brain->SetLLMBackend(Mock);
+		}
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FWytchWaitUntilCommand(this, TEXT("brain boot"), 10.0, [Scenario]()
+	{
+		const TArray<AForeman_AIController*> Foremen = Scenario->GetForemen();
+		const UForeman_BrainComponent* Brain = Foremen.Num() > 0 ? Foremen[0]->GetForemanBrain() : nullptr;
+		return Brain && Brain->IsBooted();
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Scenario]()
+	{
+		// The boot wait only reports a timeout — a failed spawn or boot must fail here, not crash
+		const TArray<AForeman_AIController*> Foremen = Scenario->GetForemen();
+		UForeman_BrainComponent* Brain = Foremen.Num() > 0 ? Foremen[0]->GetForemanBrain() : nullptr;
+		if (!Brain)
+		{
+			AddError(TEXT("No Foreman brain to command"));
+			return true;
+		}
+		Brain->IssueCommand(TEXT("find the red cone"));
+		return true;
+	}));
+
+	// Mock never finds the target — a full look-around (4 snaps) ends back in Idle
+	ADD_LATENT_AUTOMATION_COMMAND(FWytchWaitUntilCommand(this, TEXT("look-around to finish"), 60.0, [Scenario, Mock]()
+	{
+		const TArray<AForeman_AIController*> Foremen = Scenario->GetForemen();
+		const UForeman_BrainComponent* Brain = Foremen.Num() > 0 ? Foremen[0]->GetForemanBrain() : nullptr;
+		return Brain && Mock->GetNumRequests() >= 4 && Brain->GetState() == EForemanState::Idle;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Scenario, Mock]()
+	{
+		TestTrue(TEXT("Request carries the command context"), Mock->GetLastRequest().Body.Contains(TEXT("context:")));
+		TestFalse(TEXT("No image captured for the mock"), Mock->GetLastRequest().Body.Contains(TEXT("base64,iVBOR")));
+		Scenario->Destroy();
+		return true;
+	}));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -15,7 +15,8 @@ public class TheWytching : ModuleRules
 			"AIModule", "NavigationSystem",
 			"GameplayAbilities", "GameplayTags", "GameplayTasks",
 			"StateTreeModule", "GameplayStateTreeModule",
-			"SmartObjectsModule"
+			"SmartObjectsModule",
+			"MassEntity", "MassCommon"
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[] { });
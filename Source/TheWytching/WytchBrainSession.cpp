@@ -0,0 +1,275 @@
+#include "WytchBrainSession.h"
+
+#include "Foreman_BrainComponent.h"
+#include "WytchEventLog.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Base64.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectIterator.h"
+
+// ─────────────────────────────────────────────────────────
+// Session file
+// ─────────────────────────────────────────────────────────
+
+FArchive& operator<<(FArchive& Ar, FWytchBrainSessionSnap& Snap)
+{
+	Ar << Snap.RequestSeconds;
+	Ar << Snap.ResponseSeconds;
+	Ar << Snap.NetworkSeconds;
+	Ar << Snap.Command;
+	Ar << Snap.Context;
+	Ar << Snap.Image;
+	Ar << Snap.bSuccess;
+	Ar << Snap.Response;
+	return Ar;
+}
+
+bool FWytchBrainSession::Load(const FString& Path, FWytchBrainSession& OutSession, FString& OutError)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path));
+	if (!Reader)
+	{
+		OutError = FString::Printf(TEXT("cannot open %s"), *Path);
+		return false;
+	}
+
+	uint32 FileMagic = 0;
+	uint32 FileVersion = 0;
+	int64 Ticks = 0;
+	*Reader << FileMagic << FileVersion << Ticks;
+	if (FileMagic != Magic || FileVersion != Version)
+	{
+		OutError = FString::Printf(TEXT("%s is not a v%u brain session"), *Path, Version);
+		return false;
+	}
+
+	OutSession.RecordedUtc = FDateTime(Ticks);
+	OutSession.Snaps.Reset();
+
+	// Snaps are appended as responses arrive — a recording cut short just ends early
+	while (!Reader->AtEnd())
+	{
+		FWytchBrainSessionSnap Snap;
+		*Reader << Snap;
+		if (Reader->IsError())
+		{
+			break;
+		}
+		OutSession.Snaps.Add(MoveTemp(Snap));
+	}
+	return true;
+}
+
+FString FWytchBrainSession::MakeDefaultPath(const FString& Name)
+{
+	return FPaths::Combine(FPaths::ProfilingDir(), TEXT("WytchSessions"),
+		FString::Printf(TEXT("%s-%s.wybs"), *Name, *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"))));
+}
+
+// ─────────────────────────────────────────────────────────
+// FWytchRecordingLLMBackend
+// ─────────────────────────────────────────────────────────
+
+FWytchRecordingLLMBackend::FWytchRecordingLLMBackend(TSharedRef<IWytchLLMBackend> InInner, const FString& InPath)
+	: Inner(InInner)
+	, Path(InPath)
+	, StartSeconds(FPlatformTime::Seconds())
+{
+	Writer.Reset(IFileManager::Get().CreateFileWriter(*Path));
+	if (!Writer)
+	{
+		WYTCH_EVENT(Brain, Error, TEXT("Session recording: cannot create %s"), *Path);
+		return;
+	}
+
+	uint32 FileMagic = FWytchBrainSession::Magic;
+	uint32 FileVersion = FWytchBrainSession::Version;
+	int64 Ticks = FDateTime::UtcNow().GetTicks();
+	*Writer << FileMagic << FileVersion << Ticks;
+}
+
+FWytchRecordingLLMBackend::~FWytchRecordingLLMBackend()
+{
+	Close();
+}
+
+void FWytchRecordingLLMBackend::Close()
+{
+	if (Writer)
+	{
+		Writer->Close();
+		Writer.Reset();
+	}
+}
+
+void FWytchRecordingLLMBackend::Send(const FWytchLLMRequest& Request, FOnWytchLLMResponse OnResponse)
+{
+	TSharedRef<FWytchBrainSessionSnap> Snap = MakeShared<FWytchBrainSessionSnap>();
+	Snap->RequestSeconds = FPlatformTime::Seconds() - StartSeconds;
+	Snap->Command = Request.Command;
+	Snap->Context = Request.Context;
+	if (!Request.ImageBase64.IsEmpty())
+	{
+		FBase64::Decode(Request.ImageBase64, Snap->Image);
+	}
+
+	TWeakPtr<IWytchLLMBackend> WeakThis = AsShared();
+	Inner->Send(Request, FOnWytchLLMResponse::CreateLambda(
+		[WeakThis, Snap, OnResponse](const FWytchLLMResponse& Response)
+		{
+			if (TSharedPtr<IWytchLLMBackend> Pinned = WeakThis.Pin())
+			{
+				FWytchRecordingLLMBackend& Recorder = static_cast<FWytchRecordingLLMBackend&>(*Pinned);
+				Snap->ResponseSeconds = FPlatformTime::Seconds() - Recorder.StartSeconds;
+				Snap->NetworkSeconds = Response.NetworkSeconds;
+				Snap->bSuccess = Response.bSuccess;
+				Snap->Response = Response.Content;
+				Recorder.Append(*Snap);
+			}
+			OnResponse.ExecuteIfBound(Response);
+		}));
+}
+
+void FWytchRecordingLLMBackend::Append(FWytchBrainSessionSnap& Snap)
+{
+	if (!Writer) return;
+
+	*Writer << Snap;
+	Writer->Flush();
+	++NumSnaps;
+}
+
+// ─────────────────────────────────────────────────────────
+// FWytchReplayLLMBackend
+// ─────────────────────────────────────────────────────────
+
+FWytchReplayLLMBackend::FWytchReplayLLMBackend(FWytchBrainSession&& InSession, float InTimeScale)
+	: Session(MoveTemp(InSession))
+	, TimeScale(FMath::Max(InTimeScale, 0.f))
+{
+}
+
+void FWytchReplayLLMBackend::Send(const FWytchLLMRequest& Request, FOnWytchLLMResponse OnResponse)
+{
+	FWytchLLMResponse Result;
+	float Delay = 0.f;
+
+	if (IsFinished())
+	{
+		WYTCH_EVENT(Brain, Warning, TEXT("Replay: session exhausted after %d snaps"), Session.Snaps.Num());
+	}
+	else
+	{
+		const int32 Index = NextSnap++;
+		const FWytchBrainSessionSnap& Snap = Session.Snaps[Index];
+
+		if (!Request.Context.Equals(Snap.Context, ESearchCase::CaseSensitive))
+		{
+			++NumDivergences;
+			WYTCH_EVENT(Brain, Warning, TEXT("Replay: snap %d context differs from the recording"), Index);
+		}
+
+		Result.bSuccess = Snap.bSuccess;
+		Result.Content = Snap.Response;
+		Result.NetworkSeconds = Snap.NetworkSeconds * TimeScale;
+		Delay = static_cast<float>(FMath::Max(Snap.ResponseSeconds - Snap.RequestSeconds, 0.0) * TimeScale);
+	}
+
+	// Same contract as the live backends: never re-entrant
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[OnResponse, Result](float)
+		{
+			OnResponse.ExecuteIfBound(Result);
+			return false;
+		}), Delay);
+}
+
+// ─────────────────────────────────────────────────────────
+// Console commands — apply to every brain in a game world
+// ─────────────────────────────────────────────────────────
+
+namespace WytchBrainSession
+{
+	static TArray<UForeman_BrainComponent*> GetGameBrains()
+	{
+		TArray<UForeman_BrainComponent*> Brains;
+		for (TObjectIterator<UForeman_BrainComponent> It; It; ++It)
+		{
+			const UWorld* World = It->GetWorld();
+			if (World && World->IsGameWorld() && !It->IsTemplate())
+			{
+				Brains.Add(*It);
+			}
+		}
+		return Brains;
+	}
+
+	/** File as given for a single brain; owner-suffixed when several brains record at once. */
+	static FString MakeBrainPath(const FString& File, const UForeman_BrainComponent& Brain, bool bSuffix)
+	{
+		const FString OwnerName = GetNameSafe(Brain.GetOwner());
+		if (File.IsEmpty())
+		{
+			return FWytchBrainSession::MakeDefaultPath(OwnerName);
+		}
+		return bSuffix
+			? FPaths::Combine(FPaths::GetPath(File), FString::Printf(TEXT("%s-%s.%s"),
+				*FPaths::GetBaseFilename(File), *OwnerName, *FPaths::GetExtension(File)))
+			: File;
+	}
+
+	static FAutoConsoleCommand RecordCommand(
+		TEXT("wytch.brain.record"),
+		TEXT("Records every Foreman brain's snaps and LLM responses to a session file. Optional arg: file (default Saved/Profiling/WytchSessions/)."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const TArray<UForeman_BrainComponent*> Brains = GetGameBrains();
+			for (UForeman_BrainComponent* Brain : Brains)
+			{
+				Brain->StartRecording(MakeBrainPath(Args.Num() > 0 ? Args[0] : FString(), *Brain, Brains.Num() > 1));
+			}
+		}));
+
+	static FAutoConsoleCommand RecordStopCommand(
+		TEXT("wytch.brain.record.stop"),
+		TEXT("Stops session recording on every Foreman brain."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			for (UForeman_BrainComponent* Brain : GetGameBrains())
+			{
+				Brain->StopRecording();
+			}
+		}));
+
+	static FAutoConsoleCommand ReplayCommand(
+		TEXT("wytch.brain.replay"),
+		TEXT("Replays a session file into every Foreman brain. Args: file, optional time scale (1 = recorded timing, 0 = as fast as possible)."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			if (Args.Num() == 0)
+			{
+				UE_LOG(LogWytchEvent, Warning, TEXT("wytch.brain.replay <File> [TimeScale]"));
+				return;
+			}
+			const float TimeScale = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 1.f;
+			for (UForeman_BrainComponent* Brain : GetGameBrains())
+			{
+				Brain->StartReplay(Args[0], TimeScale);
+			}
+		}));
+
+	static FAutoConsoleCommand ReplayStopCommand(
+		TEXT("wytch.brain.replay.stop"),
+		TEXT("Ends session replay and restores the default LLM backend."),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			for (UForeman_BrainComponent* Brain : GetGameBrains())
+			{
+				Brain->StopReplay();
+			}
+		}));
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WytchLLMBackend.h"
+
+// ─────────────────────────────────────────────────────────
+// Foreman brain sessions — record / replay
+//   A session file (.wybs) holds every snap's inputs (command,
+//   perception context, PNG) and the raw LLM response, with
+//   request/response times relative to the start of recording.
+//   FWytchRecordingLLMBackend wraps the live backend and appends
+//   one snap per response; FWytchReplayLLMBackend answers from a
+//   loaded session with no server and no capture, at recorded
+//   latency × TimeScale (0 = next tick).
+//
+//   wytch.brain.record [File] / wytch.brain.record.stop
+//   wytch.brain.replay File [TimeScale] / wytch.brain.replay.stop
+//   -WytchRecordLLM, -WytchReplayLLM=File [-WytchReplayScale=0]
+// ─────────────────────────────────────────────────────────
+
+struct FWytchBrainSessionSnap
+{
+	/** Seconds since recording started. */
+	double RequestSeconds = 0.0;
+	double ResponseSeconds = 0.0;
+
+	/** Backend-reported transport time. */
+	double NetworkSeconds = 0.0;
+
+	FString Command;
+	FString Context;
+
+	/** PNG bytes as captured. Empty when the backend skipped capture. */
+	TArray<uint8> Image;
+
+	bool bSuccess = false;
+
+	/** Raw response body — the chat-completion JSON. */
+	FString Response;
+
+	friend FArchive& operator<<(FArchive& Ar, FWytchBrainSessionSnap& Snap);
+};
+
+struct THEWYTCHING_API FWytchBrainSession
+{
+	static constexpr uint32 Magic = 0x53425957;	// "WYBS"
+	static constexpr uint32 Version = 1;
+
+	FDateTime RecordedUtc;
+	TArray<FWytchBrainSessionSnap> Snaps;
+
+	static bool Load(const FString& Path, FWytchBrainSession& OutSession, FString& OutError);
+
+	/** Saved/Profiling/WytchSessions/<Name>-<timestamp>.wybs */
+	static FString MakeDefaultPath(const FString& Name);
+};
+
+class THEWYTCHING_API FWytchRecordingLLMBackend : public IWytchLLMBackend
+{
+public:
+	FWytchRecordingLLMBackend(TSharedRef<IWytchLLMBackend> InInner, const FString& InPath);
+	virtual ~FWytchRecordingLLMBackend() override;
+
+	/** False if the file could not be created — Send still forwards, nothing is written. */
+	bool IsOpen() const { return Writer.IsValid(); }
+
+	/** Flushes and closes the file. Responses still in flight are forwarded but not recorded. */
+	void Close();
+
+	TSharedRef<IWytchLLMBackend> GetInner() const { return Inner; }
+	const FString& GetPath() const { return Path; }
+	int32 GetNumSnaps() const { return NumSnaps; }
+
+	virtual void Send(const FWytchLLMRequest& Request, FOnWytchLLMResponse OnResponse) override;
+	virtual bool WantsImage() const override { return Inner->WantsImage(); }
+
+private:
+	void Append(FWytchBrainSessionSnap& Snap);
+
+	TSharedRef<IWytchLLMBackend> Inner;
+	TUniquePtr<FArchive> Writer;
+	FString Path;
+	double StartSeconds = 0.0;
+	int32 NumSnaps = 0;
+};
+
+class THEWYTCHING_API FWytchReplayLLMBackend : public IWytchLLMBackend
+{
+public:
+	/** TimeScale multiplies recorded latency: 1 = as recorded, 0 = next tick. */
+	FWytchReplayLLMBackend(FWytchBrainSession&& InSession, float InTimeScale);
+
+	const FWytchBrainSession& GetSession() const { return Session; }
+	float GetTimeScale() const { return TimeScale; }
+	bool IsFinished() const { return NextSnap >= Session.Snaps.Num(); }
+
+	/** The snap the next Send answers with. Null once finished. */
+	const FWytchBrainSessionSnap* GetNextSnap() const { return Session.Snaps.IsValidIndex(NextSnap) ? &Session.Snaps[NextSnap] : nullptr; }
+
+	/** Requests whose perception context differed from the recording. */
+	int32 GetNumDivergences() const { return NumDivergences; }
+
+	virtual void Send(const FWytchLLMRequest& Request, FOnWytchLLMResponse OnResponse) override;
+	virtual bool WantsImage() const override { return false; }
+
+private:
+	FWytchBrainSession Session;
+	float TimeScale = 1.f;
+	int32 NextSnap = 0;
+	int32 NumDivergences = 0;
+};
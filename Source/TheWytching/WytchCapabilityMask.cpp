@@ -0,0 +1,143 @@
+#include "WytchCapabilityMask.h"
+
+#include "AndroidTypes.h"
+#include "GameplayTagsManager.h"
+
+const FWytchCapabilityRegistry& FWytchCapabilityRegistry::Get()
+{
+	static const FWytchCapabilityRegistry Registry;
+	return Registry;
+}
+
+FWytchCapabilityRegistry::FWytchCapabilityRegistry()
+{
+	const UGameplayTagsManager& TagsManager = UGameplayTagsManager::Get();
+	CapabilityRoot = TagsManager.RequestGameplayTag(FName(TEXT("Capability")), /*ErrorIfNotFound=*/false);
+	TaskRoot = TagsManager.RequestGameplayTag(FName(TEXT("Task")), /*ErrorIfNotFound=*/false);
+
+	TArray<FGameplayTag> Tags;
+	if (CapabilityRoot.IsValid())
+	{
+		Tags.Add(CapabilityRoot);
+		for (const FGameplayTag& Child : TagsManager.RequestGameplayTagChildren(CapabilityRoot))
+		{
+			Tags.Add(Child);
+		}
+	}
+
+	Tags.Sort([](const FGameplayTag& A, const FGameplayTag& B)
+	{
+		return A.GetTagName().LexicalLess(B.GetTagName());
+	});
+
+	for (const FGameplayTag& Tag : Tags)
+	{
+		if (TagToBit.Num() >= MaxBits)
+		{
+			UE_LOG(LogWytchAndroid, Error,
+				TEXT("CapabilityRegistry: more than %d Capability tags — %s and later fall back to tag-container matching"),
+				MaxBits, *Tag.ToString());
+			break;
+		}
+		TagToBit.Add(Tag, TagToBit.Num());
+	}
+
+	for (const FWytchTaskCapabilities& Row : GetDefault<UWytchCapabilitySettings>()->TaskCapabilities)
+	{
+		if (!TaskRoot.IsValid() || !Row.Task.MatchesTag(TaskRoot))
+		{
+			UE_LOG(LogWytchAndroid, Warning, TEXT("CapabilityRegistry: '%s' is not a Task tag — row ignored"),
+				*Row.Task.ToString());
+			continue;
+		}
+
+		FGameplayTagContainer& Capabilities = TaskToCapabilities.FindOrAdd(Row.Task);
+		for (const FGameplayTag& Capability : Row.Capabilities)
+		{
+			if (CapabilityRoot.IsValid() && Capability.MatchesTag(CapabilityRoot))
+			{
+				Capabilities.AddTag(Capability);
+			}
+			else
+			{
+				UE_LOG(LogWytchAndroid, Warning, TEXT("CapabilityRegistry: %s maps to non-Capability tag '%s' — ignored"),
+					*Row.Task.ToString(), *Capability.ToString());
+			}
+		}
+	}
+
+	UE_LOG(LogWytchAndroid, Log, TEXT("CapabilityRegistry: %d capability tags mapped, %d task rows"),
+		TagToBit.Num(), TaskToCapabilities.Num());
+}
+
+int32 FWytchCapabilityRegistry::GetBitIndex(const FGameplayTag& Tag) const
+{
+	const int32* Bit = TagToBit.Find(Tag);
+	return Bit ? *Bit : INDEX_NONE;
+}
+
+FGameplayTagContainer FWytchCapabilityRegistry::FilterDispatchTags(const FGameplayTagContainer& Tags) const
+{
+	FGameplayTagContainer Result;
+	for (const FGameplayTag& Tag : Tags)
+	{
+		if ((CapabilityRoot.IsValid() && Tag.MatchesTag(CapabilityRoot)) || (TaskRoot.IsValid() && Tag.MatchesTag(TaskRoot)))
+		{
+			Result.AddTagFast(Tag);
+		}
+	}
+	return Result;
+}
+
+FGameplayTagContainer FWytchCapabilityRegistry::ToCapabilities(const FGameplayTagContainer& Tags) const
+{
+	FGameplayTagContainer Result;
+	for (const FGameplayTag& Tag : Tags)
+	{
+		if (CapabilityRoot.IsValid() && Tag.MatchesTag(CapabilityRoot))
+		{
+			Result.AddTag(Tag);
+		}
+		else if (TaskRoot.IsValid() && Tag.MatchesTag(TaskRoot))
+		{
+			// Nearest listed task wins — Task.Carry.Heavy falls back to Task.Carry
+			for (FGameplayTag Task = Tag; Task.IsValid(); Task = Task.RequestDirectParent())
+			{
+				if (const FGameplayTagContainer* Capabilities = TaskToCapabilities.Find(Task))
+				{
+					Result.AppendTags(*Capabilities);
+					break;
+				}
+			}
+		}
+	}
+	return Result;
+}
+
+FWytchCapabilityMask FWytchCapabilityRegistry::MakeWorkerMask(const FGameplayTagContainer& Capabilities) const
+{
+	return MakeMask(ToCapabilities(Capabilities).GetGameplayTagParents());
+}
+
+FWytchCapabilityMask FWytchCapabilityRegistry::MakeRequirementMask(const FGameplayTagContainer& Requirements) const
+{
+	return MakeMask(ToCapabilities(Requirements));
+}
+
+FWytchCapabilityMask FWytchCapabilityRegistry::MakeMask(const FGameplayTagContainer& CapabilityTags) const
+{
+	FWytchCapabilityMask Mask;
+	for (const FGameplayTag& Tag : CapabilityTags)
+	{
+		const int32 Bit = GetBitIndex(Tag);
+		if (Bit != INDEX_NONE)
+		{
+			Mask.Bits |= uint64(1) << Bit;
+		}
+		else
+		{
+			Mask.OverflowTags.AddTagFast(Tag);
+		}
+	}
+	return Mask;
+}
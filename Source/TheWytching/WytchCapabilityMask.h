@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "WytchCapabilityMask.generated.h"
+
+// ─────────────────────────────────────────────────────────
+// FWytchCapabilityMask — Capability.* tags as a 64-bit set
+//   Worker masks include parent tags (Capability.X also sets
+//   Capability) and requirement masks hold the exact tags, so
+//   Covers() gives the same answer as FGameplayTagContainer::HasAll
+//   in one AND + compare. Task.* tags never reach a mask — the
+//   registry maps them to the capabilities they need first.
+//   Tags past MaxBits ride along in OverflowTags and are matched
+//   as a container; that list is empty in a healthy project.
+// ─────────────────────────────────────────────────────────
+struct FWytchCapabilityMask
+{
+	uint64 Bits = 0;
+
+	/** Capability tags without a bit (registry overflow). */
+	FGameplayTagContainer OverflowTags;
+
+	bool IsEmpty() const { return Bits == 0 && OverflowTags.IsEmpty(); }
+
+	/** True if every capability in Required is held here. */
+	bool Covers(const FWytchCapabilityMask& Required) const
+	{
+		return (Bits & Required.Bits) == Required.Bits
+			&& (Required.OverflowTags.IsEmpty() || OverflowTags.HasAllExact(Required.OverflowTags));
+	}
+
+	bool operator==(const FWytchCapabilityMask& Other) const { return Bits == Other.Bits && OverflowTags == Other.OverflowTags; }
+	bool operator!=(const FWytchCapabilityMask& Other) const { return !(*this == Other); }
+};
+
+// ─────────────────────────────────────────────────────────
+// FWytchTaskCapabilities — one row of the Task → Capability table
+// ─────────────────────────────────────────────────────────
+USTRUCT()
+struct FWytchTaskCapabilities
+{
+	GENERATED_BODY()
+
+	/** Task.* tag as found on a SmartObject slot (or a specialist worker). */
+	UPROPERTY(EditAnywhere, Category = "Capability")
+	FGameplayTag Task;
+
+	/** Capability.* tags a worker needs to take that task. */
+	UPROPERTY(EditAnywhere, Category = "Capability")
+	FGameplayTagContainer Capabilities;
+};
+
+/**
+ * What each kind of work asks of a worker. Slots describe work with Task.*
+ * tags and workers describe themselves with Capability.* tags; this table
+ * joins the two. A task without a row uses its nearest listed parent, and
+ * one with none needs no capability at all (Task.Idle, Task.Recharge).
+ * Rows live in DefaultGame.ini under [/Script/TheWytching.WytchCapabilitySettings].
+ */
+UCLASS(Config = Game)
+class THEWYTCHING_API UWytchCapabilitySettings : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(Config, EditAnywhere, Category = "Capability")
+	TArray<FWytchTaskCapabilities> TaskCapabilities;
+};
+
+// ─────────────────────────────────────────────────────────
+// FWytchCapabilityRegistry — tag → bit lookup
+//   Built once, on first use, from every registered Capability.*
+//   tag (DefaultGameplayTags.ini) and UWytchCapabilitySettings.
+//   Bits are assigned in tag-name order so masks are stable
+//   between runs.
+// ─────────────────────────────────────────────────────────
+class THEWYTCHING_API FWytchCapabilityRegistry
+{
+public:
+	static constexpr int32 MaxBits = 64;
+
+	static const FWytchCapabilityRegistry& Get();
+
+	/** Mask of a worker's capabilities — Task.* tags mapped, then every tag plus its parents. */
+	FWytchCapabilityMask MakeWorkerMask(const FGameplayTagContainer& Capabilities) const;
+
+	/** Mask of what a slot asks for — Task.* tags mapped, Capability.* tags exact. */
+	FWytchCapabilityMask MakeRequirementMask(const FGameplayTagContainer& Requirements) const;
+
+	/** The Task.* / Capability.* subset of Tags — what dispatch matches on. */
+	FGameplayTagContainer FilterDispatchTags(const FGameplayTagContainer& Tags) const;
+
+	/** Capability.* tags kept, Task.* tags replaced by their mapped capabilities, anything else dropped. */
+	FGameplayTagContainer ToCapabilities(const FGameplayTagContainer& Tags) const;
+
+	/** INDEX_NONE if the tag is not a Capability.* tag or has no bit. */
+	int32 GetBitIndex(const FGameplayTag& Tag) const;
+
+	int32 Num() const { return TagToBit.Num(); }
+
+private:
+	FWytchCapabilityRegistry();
+
+	FWytchCapabilityMask MakeMask(const FGameplayTagContainer& CapabilityTags) const;
+
+	TMap<FGameplayTag, int32> TagToBit;
+	TMap<FGameplayTag, FGameplayTagContainer> TaskToCapabilities;
+
+	FGameplayTag CapabilityRoot;
+	FGameplayTag TaskRoot;
+};
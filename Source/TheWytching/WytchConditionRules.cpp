@@ -0,0 +1,98 @@
+#include "WytchConditionRules.h"
+
+#include "WytchCapabilityMask.h"
+
+const FWytchConditionRuleTable& FWytchConditionRuleTable::Get()
+{
+	static const FWytchConditionRuleTable Table;
+	return Table;
+}
+
+FWytchConditionRuleTable::FWytchConditionRuleTable()
+{
+	const UWytchConditionRules* Settings = GetDefault<UWytchConditionRules>();
+
+	// Built-in subsystems take the low bits in enum order
+	const UEnum* SubsystemEnum = StaticEnum<ESubsystemType>();
+	for (int32 Bit = 0; Bit < NumBuiltInSubsystems; ++Bit)
+	{
+		SubsystemToBit.Add(FName(SubsystemEnum->GetNameStringByValue(Bit)), Bit);
+	}
+
+	for (const FName Name : Settings->ExtraSubsystems)
+	{
+		if (SubsystemToBit.Contains(Name)) continue;
+		if (SubsystemToBit.Num() >= MaxSubsystems)
+		{
+			UE_LOG(LogWytchAndroid, Error,
+				TEXT("ConditionRules: more than %d subsystems — %s and later are ignored"),
+				MaxSubsystems, *Name.ToString());
+			break;
+		}
+		SubsystemToBit.Add(Name, SubsystemToBit.Num());
+	}
+
+	const uint32 AllSubsystems = SubsystemToBit.Num() >= 32 ? MAX_uint32 : (uint32(1) << SubsystemToBit.Num()) - 1;
+	const FWytchCapabilityRegistry& Registry = FWytchCapabilityRegistry::Get();
+
+	for (const FWytchConditionRule& Rule : Settings->Rules)
+	{
+		FCompiledRule& Compiled = Rules.AddDefaulted_GetRef();
+		Compiled.bDestroyedOnly = Rule.MinStatus == ESubsystemStatus::Destroyed;
+		Compiled.bRequireAll = Rule.bRequireAll;
+		Compiled.RemovedCapabilities = Registry.ToCapabilities(Rule.RemovesCapabilities);
+		Compiled.Readiness = Rule.Readiness;
+
+		for (const FName Name : Rule.Subsystems)
+		{
+			const int32 Bit = GetSubsystemBit(Name);
+			if (Bit == INDEX_NONE)
+			{
+				UE_LOG(LogWytchAndroid, Warning, TEXT("ConditionRules: unknown subsystem '%s' in rule %d"),
+					*Name.ToString(), Rules.Num() - 1);
+				continue;
+			}
+			Compiled.SubsystemMask |= uint32(1) << Bit;
+		}
+		if (Rule.Subsystems.IsEmpty())
+		{
+			Compiled.SubsystemMask = AllSubsystems;
+		}
+
+		// An Operational threshold or an empty mask would fire always / never — neither is a rule
+		if (Rule.MinStatus == ESubsystemStatus::Operational || Compiled.SubsystemMask == 0)
+		{
+			UE_LOG(LogWytchAndroid, Warning, TEXT("ConditionRules: rule %d can never fire usefully — skipped"),
+				Rules.Num() - 1);
+			Rules.Pop(EAllowShrinking::No);
+		}
+	}
+
+	UE_LOG(LogWytchAndroid, Log, TEXT("ConditionRules: %d subsystems, %d rules compiled"),
+		SubsystemToBit.Num(), Rules.Num());
+}
+
+int32 FWytchConditionRuleTable::GetSubsystemBit(FName Name) const
+{
+	const int32* Bit = SubsystemToBit.Find(Name);
+	return Bit ? *Bit : INDEX_NONE;
+}
+
+FWytchConditionEffects FWytchConditionRuleTable::Evaluate(uint32 DegradedBits, uint32 DestroyedBits) const
+{
+	FWytchConditionEffects Effects;
+	if (DegradedBits == 0 && DestroyedBits == 0)
+	{
+		return Effects;
+	}
+
+	for (const FCompiledRule& Rule : Rules)
+	{
+		const uint32 Hit = (Rule.bDestroyedOnly ? DestroyedBits : DegradedBits) & Rule.SubsystemMask;
+		if (Rule.bRequireAll ? Hit != Rule.SubsystemMask : Hit == 0) continue;
+
+		Effects.RemovedCapabilities.AppendTags(Rule.RemovedCapabilities);
+		Effects.Readiness = FMath::Max(Effects.Readiness, Rule.Readiness);
+	}
+	return Effects;
+}
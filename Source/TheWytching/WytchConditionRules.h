@@ -0,0 +1,117 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "AndroidTypes.h"
+#include "WytchConditionRules.generated.h"
+
+// ─────────────────────────────────────────────────────────
+// FWytchConditionRule — one row of the subsystem → effect table
+// ─────────────────────────────────────────────────────────
+USTRUCT(BlueprintType)
+struct FWytchConditionRule
+{
+	GENERATED_BODY()
+
+	/**
+	 * Subsystems this rule watches — ESubsystemType names (Vision, Locomotion, ...)
+	 * or names listed in ExtraSubsystems. Empty = every subsystem.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Condition")
+	TArray<FName> Subsystems;
+
+	/** Status at or beyond which a watched subsystem counts as hit. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Condition")
+	ESubsystemStatus MinStatus = ESubsystemStatus::Destroyed;
+
+	/** Fire only when every watched subsystem is hit, rather than any one. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Condition")
+	bool bRequireAll = false;
+
+	/** Capability tags removed from ActiveCapabilities while the rule fires. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Condition")
+	FGameplayTagContainer RemovesCapabilities;
+
+	/** Readiness floor while the rule fires — GetReadiness reports the worst. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Condition")
+	EAndroidReadiness Readiness = EAndroidReadiness::FullyOperational;
+};
+
+/**
+ * Designer table mapping subsystem damage to capability loss and readiness.
+ * Rows live in DefaultGame.ini under [/Script/TheWytching.WytchConditionRules];
+ * new subsystems (sensors, tools) are added by name in ExtraSubsystems and set
+ * on an android through UAndroidConditionComponent::SetSubsystemStatusByName.
+ * Read once into FWytchConditionRuleTable.
+ */
+UCLASS(Config = Game)
+class THEWYTCHING_API UWytchConditionRules : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Subsystems beyond ESubsystemType. */
+	UPROPERTY(Config, EditAnywhere, Category = "Condition")
+	TArray<FName> ExtraSubsystems;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Condition")
+	TArray<FWytchConditionRule> Rules;
+};
+
+// ─────────────────────────────────────────────────────────
+// FWytchConditionEffects — what a set of damaged subsystems does
+// ─────────────────────────────────────────────────────────
+struct FWytchConditionEffects
+{
+	/** Capability.* tags removed (rule Task.* entries already mapped through UWytchCapabilitySettings). */
+	FGameplayTagContainer RemovedCapabilities;
+
+	EAndroidReadiness Readiness = EAndroidReadiness::FullyOperational;
+};
+
+// ─────────────────────────────────────────────────────────
+// FWytchConditionRuleTable — UWytchConditionRules as bitmasks
+//   Built once, on first use. Every subsystem gets a bit (the
+//   ESubsystemType values first, then ExtraSubsystems in order);
+//   each rule becomes a subsystem mask, a status, its removed
+//   capabilities and a readiness, so matching is an AND and
+//   compare per rule with no enum walks.
+// ─────────────────────────────────────────────────────────
+class THEWYTCHING_API FWytchConditionRuleTable
+{
+public:
+	static constexpr int32 MaxSubsystems = 32;
+
+	/** ESubsystemType values — bits below this are the built-in subsystem fields. */
+	static constexpr int32 NumBuiltInSubsystems = static_cast<int32>(ESubsystemType::CommLink) + 1;
+
+	static const FWytchConditionRuleTable& Get();
+
+	/**
+	 * Effects of an android whose subsystems at Degraded-or-worse and at
+	 * Destroyed are given as bitmasks (see GetSubsystemBit).
+	 */
+	FWytchConditionEffects Evaluate(uint32 DegradedBits, uint32 DestroyedBits) const;
+
+	/** INDEX_NONE if Name is neither an ESubsystemType nor an ExtraSubsystems entry. */
+	int32 GetSubsystemBit(FName Name) const;
+
+	static int32 GetSubsystemBit(ESubsystemType System) { return static_cast<int32>(System); }
+
+	int32 NumSubsystems() const { return SubsystemToBit.Num(); }
+
+private:
+	FWytchConditionRuleTable();
+
+	struct FCompiledRule
+	{
+		uint32 SubsystemMask = 0;
+		bool bDestroyedOnly = true;
+		bool bRequireAll = false;
+		FGameplayTagContainer RemovedCapabilities;
+		EAndroidReadiness Readiness = EAndroidReadiness::FullyOperational;
+	};
+
+	TArray<FCompiledRule> Rules;
+	TMap<FName, int32> SubsystemToBit;
+};
@@ -0,0 +1,295 @@
+#include "WytchDispatchScenario.h"
+
+#include "Foreman_AIController.h"
+#include "ForemanTypes.h"
+#include "NavigationSystem.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+
+const FWytchPerfBaseline* UWytchDispatchScenarioSettings::FindBaseline(const FString& Case) const
+{
+	return PerfBaselines.FindByPredicate([&Case](const FWytchPerfBaseline& Baseline)
+	{
+		return Baseline.Case.Equals(Case, ESearchCase::IgnoreCase);
+	});
+}
+
+namespace WytchDispatchScenario
+{
+	/** Offset of Index in a square grid of Count cells, centred on the origin. */
+	static FVector GridOffset(int32 Index, int32 Count, float Spacing)
+	{
+		const int32 Width = FMath::Max(1, FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count))));
+		const float Half = (Width - 1) * 0.5f;
+		return FVector((Index % Width - Half) * Spacing, (Index / Width - Half) * Spacing, 0.f);
+	}
+}
+
+bool FWytchDispatchScenario::Spawn(UWorld* World, const FWytchDispatchScenarioParams& Params, FString& OutError)
+{
+	if (!World)
+	{
+		OutError = TEXT("no world");
+		return false;
+	}
+
+	const UWytchDispatchScenarioSettings* Settings = GetDefault<UWytchDispatchScenarioSettings>();
+	UClass* ForemanClass = Settings->ForemanClass.LoadSynchronous();
+	UClass* StationClass = Settings->WorkStationClass.LoadSynchronous();
+	UClass* WorkerClasses[] =
+	{
+		Settings->ScoutClass.LoadSynchronous(),
+		Settings->LightClass.LoadSynchronous(),
+		Settings->HeavyClass.LoadSynchronous()
+	};
+	const int32 Weights[] = { Params.ClassMix.X, Params.ClassMix.Y, Params.ClassMix.Z };
+
+	int32 TotalWeight = 0;
+	for (int32 Class = 0; Class < UE_ARRAY_COUNT(WorkerClasses); ++Class)
+	{
+		if (WorkerClasses[Class] && Weights[Class] > 0)
+		{
+			TotalWeight += Weights[Class];
+		}
+	}
+
+	if (!ForemanClass || (Params.NumStations > 0 && !StationClass) || (Params.NumWorkers > 0 && TotalWeight == 0))
+	{
+		OutError = TEXT("scenario classes missing — check [/Script/TheWytching.WytchDispatchScenarioSettings]");
+		return false;
+	}
+
+	const int32 NumForemen = FMath::Max(1, Params.NumForemen);
+	if (Params.FloorMargin > 0.f)
+	{
+		SpawnFloor(*World, Params, NumForemen);
+	}
+
+	for (int32 ForemanIndex = 0; ForemanIndex < NumForemen; ++ForemanIndex)
+	{
+		const FVector Centre = Params.Origin + FVector(ForemanIndex * Params.ForemanSpacing, 0.f, 0.f);
+
+		APawn* ForemanPawn = Cast<APawn>(SpawnAt(*World, ForemanClass, Centre));
+		if (!ForemanPawn)
+		{
+			OutError = FString::Printf(TEXT("failed to spawn Foreman %d"), ForemanIndex);
+			return false;
+		}
+		if (!ForemanPawn->GetController())
+		{
+			ForemanPawn->SpawnDefaultController();
+		}
+		if (AForeman_AIController* Foreman = Cast<AForeman_AIController>(ForemanPawn->GetController()))
+		{
+			Foremen.Add(Foreman);
+		}
+		else
+		{
+			OutError = FString::Printf(TEXT("%s is not driven by a Foreman AIController"), *ForemanClass->GetName());
+			return false;
+		}
+
+		// This Foreman's share — workers in front of it, stations beyond them
+		const int32 ShareWorkers = Params.NumWorkers / NumForemen + (ForemanIndex < Params.NumWorkers % NumForemen ? 1 : 0);
+		const int32 ShareStations = Params.NumStations / NumForemen + (ForemanIndex < Params.NumStations % NumForemen ? 1 : 0);
+		const float WorkerRows = FMath::CeilToFloat(FMath::Sqrt(static_cast<float>(FMath::Max(ShareWorkers, 1))));
+		const FVector WorkerCentre = Centre + FVector(0.f, (WorkerRows * 0.5f + 1.f) * Params.Spacing, 0.f);
+		const FVector StationCentre = Centre - FVector(0.f, (FMath::CeilToFloat(FMath::Sqrt(static_cast<float>(FMath::Max(ShareStations, 1)))) * 0.5f + 1.f) * Params.Spacing, 0.f);
+
+		for (int32 Index = 0; Index < ShareStations; ++Index)
+		{
+			SpawnAt(*World, StationClass, StationCentre + WytchDispatchScenario::GridOffset(Index, ShareStations, Params.Spacing));
+		}
+
+		for (int32 Index = 0; Index < ShareWorkers; ++Index)
+		{
+			// Deterministic mix: walk the weights round-robin
+			int32 Pick = (Workers.Num() % FMath::Max(TotalWeight, 1));
+			int32 Class = 0;
+			for (; Class < UE_ARRAY_COUNT(WorkerClasses); ++Class)
+			{
+				const int32 Weight = WorkerClasses[Class] ? FMath::Max(Weights[Class], 0) : 0;
+				if (Pick < Weight) break;
+				Pick -= Weight;
+			}
+
+			APawn* Worker = Cast<APawn>(SpawnAt(*World, WorkerClasses[Class],
+				WorkerCentre + WytchDispatchScenario::GridOffset(Index, ShareWorkers, Params.Spacing)));
+			if (!Worker) continue;
+
+			if (!Worker->GetController())
+			{
+				Worker->SpawnDefaultController();
+			}
+			Workers.Add(CastChecked<AAutoBot_Character>(Worker));
+		}
+	}
+
+	UE_LOG(LogForeman, Log, TEXT("DispatchScenario: %d Foremen, %d workers, %d stations spawned at %s"),
+		Foremen.Num(), Workers.Num(), Params.NumStations, *Params.Origin.ToCompactString());
+	return true;
+}
+
+AActor* FWytchDispatchScenario::SpawnAt(UWorld& World, UClass* Class, const FVector& Location)
+{
+	if (!Class) return nullptr;
+
+	FVector SpawnLocation = Location;
+	if (const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&World))
+	{
+		FNavLocation Projected;
+		if (NavSys->ProjectPointToNavigation(Location, Projected, FVector(200.f, 200.f, 5000.f)))
+		{
+			SpawnLocation = Projected.Location;
+		}
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+	AActor* Actor = World.SpawnActor<AActor>(Class, SpawnLocation + FVector(0.f, 0.f, 100.f), FRotator::ZeroRotator, SpawnParams);
+	if (Actor)
+	{
+		SpawnedActors.Add(Actor);
+	}
+	return Actor;
+}
+
+void FWytchDispatchScenario::SpawnFloor(UWorld& World, const FWytchDispatchScenarioParams& Params, int32 NumForemen)
+{
+	UStaticMesh* Plane = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Plane.Plane"));
+	if (!Plane)
+	{
+		UE_LOG(LogForeman, Warning, TEXT("DispatchScenario: /Engine/BasicShapes/Plane missing — no floor"));
+		return;
+	}
+
+	// One plane under every Foreman's zone; the engine plane is 100 x 100 units
+	const float SpanX = (NumForemen - 1) * Params.ForemanSpacing;
+	const float HalfY = Params.ForemanSpacing * 0.5f + Params.FloorMargin;
+	const FVector Centre = Params.Origin + FVector(SpanX * 0.5f, 0.f, 0.f);
+	const FVector Scale((SpanX * 0.5f + HalfY) / 50.f, HalfY / 50.f, 1.f);
+
+	AStaticMeshActor* Floor = World.SpawnActorDeferred<AStaticMeshActor>(AStaticMeshActor::StaticClass(),
+		FTransform(FRotator::ZeroRotator, Centre, Scale));
+	if (!Floor) return;
+
+	Floor->GetStaticMeshComponent()->SetMobility(EComponentMobility::Static);
+	Floor->GetStaticMeshComponent()->SetStaticMesh(Plane);
+	Floor->FinishSpawning(FTransform(FRotator::ZeroRotator, Centre, Scale));
+	SpawnedActors.Add(Floor);
+
+	if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&World))
+	{
+		NavSys->Build();
+	}
+}
+
+void FWytchDispatchScenario::Destroy()
+{
+	for (const TWeakObjectPtr<AForeman_AIController>& Foreman : Foremen)
+	{
+		if (Foreman.IsValid())
+		{
+			SpawnedActors.Add(Foreman.Get());
+		}
+	}
+	for (const TWeakObjectPtr<AAutoBot_Character>& Worker : Workers)
+	{
+		if (Worker.IsValid() && Worker->GetController())
+		{
+			SpawnedActors.Add(Worker->GetController());
+		}
+	}
+
+	for (const TWeakObjectPtr<AActor>& Actor : SpawnedActors)
+	{
+		if (Actor.IsValid())
+		{
+			Actor->Destroy();
+		}
+	}
+	SpawnedActors.Reset();
+	Foremen.Reset();
+	Workers.Reset();
+}
+
+FForemanJobQueueStats FWytchDispatchScenario::GetJobStats() const
+{
+	FForemanJobQueueStats Total;
+	double WaitSum = 0.0;
+	double LatencySum = 0.0;
+
+	for (const AForeman_AIController* Foreman : GetForemen())
+	{
+		const FForemanJobQueueStats Stats = Foreman->GetJobQueueStats();
+		Total.NumPending += Stats.NumPending;
+		Total.NumAssigned += Stats.NumAssigned;
+		Total.NumCreated += Stats.NumCreated;
+		Total.NumArrived += Stats.NumArrived;
+		Total.NumCompleted += Stats.NumCompleted;
+		Total.NumPreempted += Stats.NumPreempted;
+		Total.NumChained += Stats.NumChained;
+		Total.NumDeadlinesMissed += Stats.NumDeadlinesMissed;
+		WaitSum += Stats.AverageWaitSeconds * Stats.NumArrived;
+		LatencySum += Stats.AverageLatencySeconds * Stats.NumArrived;
+		Total.MaxLatencySeconds = FMath::Max(Total.MaxLatencySeconds, Stats.MaxLatencySeconds);
+	}
+
+	if (Total.NumArrived > 0)
+	{
+		Total.AverageWaitSeconds = float(WaitSum / Total.NumArrived);
+		Total.AverageLatencySeconds = float(LatencySum / Total.NumArrived);
+	}
+	return Total;
+}
+
+int32 FWytchDispatchScenario::GetNumWorkers() const
+{
+	int32 Count = 0;
+	for (const TWeakObjectPtr<AAutoBot_Character>& Worker : Workers)
+	{
+		Count += Worker.IsValid() ? 1 : 0;
+	}
+	return Count;
+}
+
+int32 FWytchDispatchScenario::GetNumIdleWorkers() const
+{
+	int32 Count = 0;
+	for (const TWeakObjectPtr<AAutoBot_Character>& Worker : Workers)
+	{
+		if (Worker.IsValid() && IWytchCommandable::Execute_GetWorkerState(Worker.Get()) == EWorkerState::Idle)
+		{
+			++Count;
+		}
+	}
+	return Count;
+}
+
+TArray<AForeman_AIController*> FWytchDispatchScenario::GetForemen() const
+{
+	TArray<AForeman_AIController*> Out;
+	for (const TWeakObjectPtr<AForeman_AIController>& Foreman : Foremen)
+	{
+		if (Foreman.IsValid())
+		{
+			Out.Add(Foreman.Get());
+		}
+	}
+	return Out;
+}
+
+TArray<AAutoBot_Character*> FWytchDispatchScenario::GetWorkers() const
+{
+	TArray<AAutoBot_Character*> Out;
+	for (const TWeakObjectPtr<AAutoBot_Character>& Worker : Workers)
+	{
+		if (Worker.IsValid())
+		{
+			Out.Add(Worker.Get());
+		}
+	}
+	return Out;
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AutoBot_Character.h"
+#include "ForemanJobQueue.h"
+#include "WytchDispatchScenario.generated.h"
+
+class AForeman_AIController;
+
+// ─────────────────────────────────────────────────────────
+// FWytchPerfBaseline — stored expectations for one perf case
+//   A 0 field is not checked; a row with every field 0 fails
+//   the case. Cases without a row are recorded with a warning.
+// ─────────────────────────────────────────────────────────
+USTRUCT()
+struct FWytchPerfBaseline
+{
+	GENERATED_BODY()
+
+	/** Perf case name (e.g. "Small"). */
+	UPROPERTY(Config, EditAnywhere, Category = "Perf")
+	FString Case;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Perf")
+	float MinFramesPerSecond = 0.f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Perf")
+	float MinJobsPerMinute = 0.f;
+
+	/** Physical memory growth from before spawn to the end of the run. */
+	UPROPERTY(Config, EditAnywhere, Category = "Perf")
+	float MaxMemoryGrowthMB = 0.f;
+};
+
+/**
+ * Content and baselines for generated dispatch scenarios (automation tests,
+ * stress runs). Lives in DefaultGame.ini under
+ * [/Script/TheWytching.WytchDispatchScenarioSettings].
+ */
+UCLASS(Config = Game)
+class THEWYTCHING_API UWytchDispatchScenarioSettings : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Map the automation tests open — must have a nav mesh around the origin. */
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	FSoftObjectPath TestMap;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	FVector TestOrigin = FVector::ZeroVector;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	TSoftClassPtr<APawn> ForemanClass;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	TSoftClassPtr<AAutoBot_Character> ScoutClass;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	TSoftClassPtr<AAutoBot_Character> LightClass;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	TSoftClassPtr<AAutoBot_Character> HeavyClass;
+
+	/** SmartObject work station implementing IWytchWorkSite. */
+	UPROPERTY(Config, EditAnywhere, Category = "Scenario")
+	TSoftClassPtr<AActor> WorkStationClass;
+
+	/** Allowed shortfall (or memory overshoot) against a baseline before a perf case fails. */
+	UPROPERTY(Config, EditAnywhere, Category = "Perf", meta = (ClampMin = "0.0"))
+	float PerfTolerance = 0.15f;
+
+	UPROPERTY(Config, EditAnywhere, Category = "Perf")
+	TArray<FWytchPerfBaseline> PerfBaselines;
+
+	const FWytchPerfBaseline* FindBaseline(const FString& Case) const;
+};
+
+struct FWytchDispatchScenarioParams
+{
+	int32 NumForemen = 1;
+	int32 NumWorkers = 8;
+	int32 NumStations = 16;
+
+	/** Relative weights of Scout / Light / Heavy in the worker mix. */
+	FIntVector ClassMix = FIntVector(1, 2, 1);
+
+	FVector Origin = FVector::ZeroVector;
+
+	/** Grid pitch for workers and stations, world units. */
+	float Spacing = 400.f;
+
+	/** Distance between Foremen — keep at least twice their WorkZoneRadius so zones don't overlap. */
+	float ForemanSpacing = 10000.f;
+
+	/**
+	 * > 0 lays a flat floor this far past the outermost Foreman's zone and rebuilds
+	 * navigation on it. Needs a NavMeshBoundsVolume covering the floor and Dynamic
+	 * runtime generation in the map; otherwise use a map with baked nav.
+	 */
+	float FloorMargin = 0.f;
+};
+
+// ─────────────────────────────────────────────────────────
+// FWytchDispatchScenario
+//   Spawns Foremen, a mixed-class worker pool and work stations
+//   on a grid, snapped to the nav mesh when there is one. Each
+//   Foreman gets its share of workers and stations inside its
+//   work zone; the registry and WorkAvailability scans pick them
+//   up from there like any placed actors.
+// ─────────────────────────────────────────────────────────
+class THEWYTCHING_API FWytchDispatchScenario
+{
+public:
+	bool Spawn(UWorld* World, const FWytchDispatchScenarioParams& Params, FString& OutError);
+
+	/** Destroys everything Spawn created. */
+	void Destroy();
+
+	/** Job stats summed over every spawned Foreman — averages weighted by arrivals. */
+	FForemanJobQueueStats GetJobStats() const;
+
+	int32 GetNumWorkers() const;
+	int32 GetNumIdleWorkers() const;
+
+	TArray<AForeman_AIController*> GetForemen() const;
+	TArray<AAutoBot_Character*> GetWorkers() const;
+
+private:
+	AActor* SpawnAt(UWorld& World, UClass* Class, const FVector& Location);
+	void SpawnFloor(UWorld& World, const FWytchDispatchScenarioParams& Params, int32 NumForemen);
+
+	TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+	TArray<TWeakObjectPtr<AForeman_AIController>> Foremen;
+	TArray<TWeakObjectPtr<AAutoBot_Character>> Workers;
+};
@@ -0,0 +1,239 @@
+#include "WytchDispatchStressCommandlet.h"
+
+#include "ForemanTypes.h"
+#include "WytchDispatchScenario.h"
+#include "WytchingStats.h"
+#include "WytchLatencyStats.h"
+#include "NavigationSystem.h"
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+UWytchDispatchStressCommandlet::UWytchDispatchStressCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = true;
+	LogToConsole = true;
+}
+
+namespace WytchDispatchStress
+{
+	static UWorld* CreatePlayWorld(const FString& MapName)
+	{
+		UPackage* Package = LoadPackage(nullptr, *MapName, LOAD_None);
+		UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+		if (!World) return nullptr;
+
+		World->AddToRoot();
+		World->WorldType = EWorldType::Game;
+
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		if (!World->bIsWorldInitialized)
+		{
+			World->InitWorld(UWorld::InitializationValues()
+				.AllowAudioPlayback(false)
+				.CreatePhysicsScene(true)
+				.CreateNavigation(true)
+				.CreateAISystem(true)
+				.ShouldSimulatePhysics(true)
+				.EnableTraceCollision(true));
+		}
+		FNavigationSystem::AddNavigationSystemToWorld(*World, FNavigationSystemRunMode::GameMode);
+
+		World->UpdateWorldComponents(true, false);
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+
+		// No game instance or game mode here — start actor play directly
+		if (AWorldSettings* WorldSettings = World->GetWorldSettings())
+		{
+			WorldSettings->NotifyBeginPlay();
+			WorldSettings->NotifyMatchStarted();
+		}
+		return World;
+	}
+
+	static void DestroyPlayWorld(UWorld* World)
+	{
+		World->DestroyWorld(false);
+		GEngine->DestroyWorldContext(World);
+		World->RemoveFromRoot();
+		CollectGarbage(RF_NoFlags);
+	}
+
+	static void Step(UWorld& World, float Dt)
+	{
+		FApp::SetCurrentTime(FApp::GetCurrentTime() + Dt);
+		FApp::SetDeltaTime(Dt);
+		World.Tick(LEVELTICK_All, Dt);
+		FTSTicker::GetCoreTicker().Tick(Dt);
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+		++GFrameCounter;
+	}
+}
+
+int32 UWytchDispatchStressCommandlet::Main(const FString& Params)
+{
+	using namespace WytchDispatchStress;
+
+	const UWytchDispatchScenarioSettings* Settings = GetDefault<UWytchDispatchScenarioSettings>();
+
+	FString MapName = Settings->TestMap.GetLongPackageName();
+	FParse::Value(*Params, TEXT("Map="), MapName);
+
+	FWytchDispatchScenarioParams Scenario;
+	Scenario.Origin = Settings->TestOrigin;
+	Scenario.NumWorkers = 32;
+	Scenario.NumStations = 64;
+	FParse::Value(*Params, TEXT("Foremen="), Scenario.NumForemen);
+	FParse::Value(*Params, TEXT("Workers="), Scenario.NumWorkers);
+	FParse::Value(*Params, TEXT("Stations="), Scenario.NumStations);
+	FParse::Value(*Params, TEXT("Floor="), Scenario.FloorMargin);
+
+	FString Mix;
+	if (FParse::Value(*Params, TEXT("Mix="), Mix, false))
+	{
+		TArray<FString> Weights;
+		Mix.ParseIntoArray(Weights, TEXT(","));
+		Scenario.ClassMix = FIntVector(
+			Weights.IsValidIndex(0) ? FCString::Atoi(*Weights[0]) : 0,
+			Weights.IsValidIndex(1) ? FCString::Atoi(*Weights[1]) : 0,
+			Weights.IsValidIndex(2) ? FCString::Atoi(*Weights[2]) : 0);
+	}
+
+	float Seconds = 120.f;
+	float Hz = 30.f;
+	float WarmupSeconds = 10.f;
+	FString CsvPath;
+	FParse::Value(*Params, TEXT("Seconds="), Seconds);
+	FParse::Value(*Params, TEXT("Hz="), Hz);
+	FParse::Value(*Params, TEXT("Warmup="), WarmupSeconds);
+	FParse::Value(*Params, TEXT("Csv="), CsvPath);
+	Hz = FMath::Max(Hz, 1.f);
+	const float Dt = 1.f / Hz;
+
+	UWorld* World = CreatePlayWorld(MapName);
+	if (!World)
+	{
+		UE_LOG(LogForeman, Error, TEXT("WytchDispatchStress: could not load map %s"), *MapName);
+		return 1;
+	}
+
+	FWytchDispatchScenario Spawned;
+	FString Error;
+	if (!Spawned.Spawn(World, Scenario, Error))
+	{
+		UE_LOG(LogForeman, Error, TEXT("WytchDispatchStress: %s"), *Error);
+		DestroyPlayWorld(World);
+		return 1;
+	}
+
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(Dt);
+
+	// Warm-up: registration, first scans, path cost cache
+	for (int32 Frame = 0; Frame < FMath::CeilToInt(WarmupSeconds * Hz); ++Frame)
+	{
+		Step(*World, Dt);
+	}
+
+	const FForemanJobQueueStats Before = Spawned.GetJobStats();
+	const int32 NumWorkers = Spawned.GetNumWorkers();
+	const int32 Frames = FMath::CeilToInt(Seconds * Hz);
+	double IdleWorkerSeconds = 0.0;
+
+	FWytchLatencyStats::ResetAll();
+	FWytchCpuCostCapture::Start();
+	const double WallStart = FPlatformTime::Seconds();
+
+	for (int32 Frame = 0; Frame < Frames; ++Frame)
+	{
+		Step(*World, Dt);
+		IdleWorkerSeconds += Dt * Spawned.GetNumIdleWorkers();
+	}
+
+	const double Wall = FPlatformTime::Seconds() - WallStart;
+	FWytchCpuCostCapture::Stop();
+
+	const FForemanJobQueueStats After = Spawned.GetJobStats();
+	const double Simulated = Frames * static_cast<double>(Dt);
+	const int32 Completed = After.NumCompleted - Before.NumCompleted;
+	const double IdleFraction = NumWorkers > 0 ? IdleWorkerSeconds / (NumWorkers * Simulated) : 0.0;
+
+	// Stats carry cumulative means — recover the measured window's mean from the totals
+	const int32 Arrived = After.NumArrived - Before.NumArrived;
+	const double LatencyTotal = double(After.AverageLatencySeconds) * After.NumArrived
+		- double(Before.AverageLatencySeconds) * Before.NumArrived;
+	const double MeanLatency = Arrived > 0 ? LatencyTotal / Arrived : 0.0;
+
+	// ── Report ──
+	TArray<FString> Csv;
+	Csv.Add(TEXT("Metric,Value"));
+	auto Report = [&Csv](const TCHAR* Metric, double Value)
+	{
+		UE_LOG(LogForeman, Display, TEXT("  %-28s %12.2f"), Metric, Value);
+		Csv.Add(FString::Printf(TEXT("%s,%.4f"), Metric, Value));
+	};
+
+	UE_LOG(LogForeman, Display, TEXT("WytchDispatchStress: %s — %d Foremen, %d workers (mix %d/%d/%d), %d stations"),
+		*MapName, Spawned.GetForemen().Num(), NumWorkers,
+		Scenario.ClassMix.X, Scenario.ClassMix.Y, Scenario.ClassMix.Z, Scenario.NumStations);
+	Report(TEXT("SimulatedSeconds"), Simulated);
+	Report(TEXT("WallSeconds"), Wall);
+	Report(TEXT("SimSpeedup"), Wall > 0.0 ? Simulated / Wall : 0.0);
+	Report(TEXT("JobsCreated"), After.NumCreated - Before.NumCreated);
+	Report(TEXT("JobsCompleted"), Completed);
+	Report(TEXT("JobsPerMinute"), Completed / (Simulated / 60.0));
+	Report(TEXT("JobsChained"), After.NumChained - Before.NumChained);
+	Report(TEXT("JobsPreempted"), After.NumPreempted - Before.NumPreempted);
+	Report(TEXT("JobsArrived"), Arrived);
+	Report(TEXT("MeanLatencySeconds"), MeanLatency);
+	Report(TEXT("IdleWorkerSeconds"), IdleWorkerSeconds);
+	Report(TEXT("IdleWorkerFraction"), IdleFraction);
+
+	Csv.Add(FString());
+	Csv.Add(TEXT("Scope,Calls,TotalMs,UsPerCall,MsPerSimSecond"));
+	UE_LOG(LogForeman, Display, TEXT("  %-28s %10s %10s %10s %12s"), TEXT("scope"), TEXT("calls"), TEXT("total ms"), TEXT("us/call"), TEXT("ms/sim s"));
+	for (const FWytchCpuCostCapture::FEntry& Entry : FWytchCpuCostCapture::GetEntries())
+	{
+		const double TotalMs = FPlatformTime::ToMilliseconds64(Entry.Cycles);
+		const double UsPerCall = Entry.Calls > 0 ? TotalMs * 1000.0 / Entry.Calls : 0.0;
+		const double MsPerSimSecond = TotalMs / Simulated;
+		UE_LOG(LogForeman, Display, TEXT("  %-28s %10llu %10.2f %10.2f %12.3f"), *Entry.Name, Entry.Calls, TotalMs, UsPerCall, MsPerSimSecond);
+		Csv.Add(FString::Printf(TEXT("%s,%llu,%.3f,%.3f,%.4f"), *Entry.Name, Entry.Calls, TotalMs, UsPerCall, MsPerSimSecond));
+	}
+
+	FWytchLatencyStats::Dump();
+
+	if (!CsvPath.IsEmpty())
+	{
+		if (FFileHelper::SaveStringArrayToFile(Csv, *CsvPath))
+		{
+			UE_LOG(LogForeman, Display, TEXT("WytchDispatchStress: wrote %s"), *CsvPath);
+		}
+		else
+		{
+			UE_LOG(LogForeman, Warning, TEXT("WytchDispatchStress: could not write %s"), *CsvPath);
+		}
+	}
+
+	Spawned.Destroy();
+	DestroyPlayWorld(World);
+	FApp::SetUseFixedTimeStep(false);
+
+	if (Completed == 0 && Scenario.NumStations > 0 && NumWorkers > 0)
+	{
+		UE_LOG(LogForeman, Error, TEXT("WytchDispatchStress: no jobs completed — check nav mesh and scenario classes"));
+		return 2;
+	}
+	return 0;
+}
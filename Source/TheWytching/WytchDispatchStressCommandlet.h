@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "WytchDispatchStressCommandlet.generated.h"
+
+/**
+ * Headless Foreman dispatch stress run.
+ *
+ *   UnrealEditor-Cmd TheWytching.uproject -run=WytchDispatchStress -nullrhi -WytchMockLLM
+ *     [-Map=/Game/...]  [-Foremen=1] [-Workers=32] [-Stations=64] [-Mix=1,2,1]
+ *     [-Seconds=120] [-Warmup=10] [-Hz=30] [-Floor=2000] [-Csv=Path]
+ *
+ * Loads the map (default: the scenario settings' TestMap), spawns an
+ * FWytchDispatchScenario, ticks the world at a fixed timestep for -Warmup
+ * simulated seconds, then for -Seconds more, and reports per-scope CPU cost
+ * (FWytchCpuCostCapture), jobs completed, mean job latency and idle worker
+ * time over that measured window only. -Floor lays a flat floor with that
+ * margin and rebuilds navigation on it (see FWytchDispatchScenarioParams).
+ */
+UCLASS()
+class THEWYTCHING_API UWytchDispatchStressCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UWytchDispatchStressCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,254 @@
+#include "WytchEventLog.h"
+
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/ScopeLock.h"
+
+DEFINE_LOG_CATEGORY(LogWytchEvent);
+
+int32 FWytchEventLog::MinRecordLevel = static_cast<int32>(WYTCH_EVENTLOG_ENABLED ? EWytchEventLevel::Trace : EWytchEventLevel::Off);
+int32 FWytchEventLog::EchoLevel = static_cast<int32>(EWytchEventLevel::Info);
+int32 FWytchEventLog::ScreenLevel = static_cast<int32>(EWytchEventLevel::Info);
+
+#if WYTCH_EVENTLOG_ENABLED
+
+namespace WytchEventLog
+{
+	static_assert(FMath::IsPowerOfTwo(FWytchEventLog::RingCapacity), "RingCapacity must be a power of two");
+
+	static float ScreenSeconds = 5.f;
+
+	static FAutoConsoleVariableRef CVarRecord(
+		TEXT("wytch.events"),
+		FWytchEventLog::MinRecordLevel,
+		TEXT("Lowest event level recorded: 0 trace (default), 1 info, 2 warning, 3 error, 4 off."));
+
+	static FAutoConsoleVariableRef CVarEcho(
+		TEXT("wytch.events.echo"),
+		FWytchEventLog::EchoLevel,
+		TEXT("Lowest recorded event level also written to LogWytchEvent: 1 info (default) … 4 never."));
+
+	static FAutoConsoleVariableRef CVarScreen(
+		TEXT("wytch.events.screen"),
+		FWytchEventLog::ScreenLevel,
+		TEXT("Lowest recorded event level also shown as an on-screen message: 1 info (default) … 4 never."));
+
+	static FAutoConsoleVariableRef CVarScreenSeconds(
+		TEXT("wytch.events.screen.seconds"),
+		ScreenSeconds,
+		TEXT("Lifetime of on-screen event messages, in seconds."));
+
+	/** Single-producer ring owned by one thread. Head counts every record ever written. */
+	struct FRing
+	{
+		FWytchEventRecord Records[FWytchEventLog::RingCapacity];
+		std::atomic<uint64> Head{0};
+		uint32 ThreadId = 0;
+	};
+
+	// Rings outlive their threads so a dump after a worker exits still sees its tail
+	static FCriticalSection RingsLock;
+	static TArray<FRing*> Rings;
+
+	static thread_local FRing* LocalRing = nullptr;
+
+	static FRing& GetLocalRing()
+	{
+		if (!LocalRing)
+		{
+			LocalRing = new FRing();
+			LocalRing->ThreadId = FPlatformTLS::GetCurrentThreadId();
+
+			FScopeLock Lock(&RingsLock);
+			Rings.Add(LocalRing);
+		}
+		return *LocalRing;
+	}
+
+	static const TCHAR* GetLevelName(EWytchEventLevel Level)
+	{
+		switch (Level)
+		{
+		case EWytchEventLevel::Trace:	return TEXT("Trace");
+		case EWytchEventLevel::Info:	return TEXT("Info");
+		case EWytchEventLevel::Warning:	return TEXT("Warning");
+		case EWytchEventLevel::Error:	return TEXT("Error");
+		default:						return TEXT("?");
+		}
+	}
+
+	static FColor GetLevelColor(EWytchEventLevel Level)
+	{
+		switch (Level)
+		{
+		case EWytchEventLevel::Trace:	return FColor::Silver;
+		case EWytchEventLevel::Info:	return FColor::Cyan;
+		case EWytchEventLevel::Warning:	return FColor::Yellow;
+		default:						return FColor::Red;
+		}
+	}
+}
+
+FWytchEventRecord& FWytchEventLog::BeginRecord(EWytchEventCategory Category, EWytchEventLevel Level)
+{
+	WytchEventLog::FRing& Ring = WytchEventLog::GetLocalRing();
+	const uint64 Index = Ring.Head.load(std::memory_order_relaxed);
+
+	FWytchEventRecord& Record = Ring.Records[Index & (RingCapacity - 1)];
+	Record.Seconds = FPlatformTime::Seconds();
+	Record.Frame = GFrameCounter;
+	Record.ThreadId = Ring.ThreadId;
+	Record.Category = Category;
+	Record.Level = Level;
+	return Record;
+}
+
+void FWytchEventLog::CommitRecord(const FWytchEventRecord& Record, const TCHAR* Text)
+{
+	using namespace WytchEventLog;
+
+	FRing& Ring = GetLocalRing();
+	Ring.Head.store(Ring.Head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+	const int32 Level = static_cast<int32>(Record.Level);
+	if (Level >= EchoLevel)
+	{
+		const TCHAR* CategoryName = GetCategoryName(Record.Category);
+		switch (Record.Level)
+		{
+		case EWytchEventLevel::Error:
+			UE_LOG(LogWytchEvent, Error, TEXT("[%s] %s"), CategoryName, Text);
+			break;
+		case EWytchEventLevel::Warning:
+			UE_LOG(LogWytchEvent, Warning, TEXT("[%s] %s"), CategoryName, Text);
+			break;
+		case EWytchEventLevel::Info:
+			UE_LOG(LogWytchEvent, Log, TEXT("[%s] %s"), CategoryName, Text);
+			break;
+		default:
+			UE_LOG(LogWytchEvent, Verbose, TEXT("[%s] %s"), CategoryName, Text);
+			break;
+		}
+	}
+
+	// On-screen messages are game-thread only
+	if (Level >= ScreenLevel && GEngine && IsInGameThread())
+	{
+		GEngine->AddOnScreenDebugMessage(-1, ScreenSeconds, GetLevelColor(Record.Level), Text);
+	}
+}
+
+TArray<FWytchEventRecord> FWytchEventLog::GetRecent(int32 MaxCount, EWytchEventCategory Category)
+{
+	using namespace WytchEventLog;
+
+	TArray<FWytchEventRecord> Result;
+	{
+		FScopeLock Lock(&RingsLock);
+		for (const FRing* Ring : Rings)
+		{
+			const uint64 Head = Ring->Head.load(std::memory_order_acquire);
+			const uint64 First = Head > RingCapacity ? Head - RingCapacity : 0;
+
+			const int32 Start = Result.Num();
+			for (uint64 Index = First; Index < Head; ++Index)
+			{
+				Result.Add(Ring->Records[Index & (RingCapacity - 1)]);
+			}
+
+			// The owner kept writing while we copied — drop any slot it may have reused
+			const uint64 HeadAfter = Ring->Head.load(std::memory_order_acquire);
+			const uint64 FirstSafe = HeadAfter + 1 > RingCapacity ? HeadAfter + 1 - RingCapacity : 0;
+			if (FirstSafe > First)
+			{
+				Result.RemoveAt(Start, static_cast<int32>(FMath::Min<uint64>(FirstSafe - First, Head - First)), EAllowShrinking::No);
+			}
+		}
+	}
+
+	if (Category != EWytchEventCategory::Num)
+	{
+		Result.RemoveAll([Category](const FWytchEventRecord& Record) { return Record.Category != Category; });
+	}
+
+	Result.Sort([](const FWytchEventRecord& A, const FWytchEventRecord& B) { return A.Seconds < B.Seconds; });
+	if (MaxCount >= 0 && Result.Num() > MaxCount)
+	{
+		Result.RemoveAt(0, Result.Num() - MaxCount);
+	}
+	return Result;
+}
+
+void FWytchEventLog::Dump(int32 MaxCount, EWytchEventCategory Category)
+{
+	const TArray<FWytchEventRecord> Records = GetRecent(MaxCount, Category);
+	const double Now = FPlatformTime::Seconds();
+
+	UE_LOG(LogWytchEvent, Display, TEXT("Wytch events (%d, newest last):"), Records.Num());
+	for (const FWytchEventRecord& Record : Records)
+	{
+		UE_LOG(LogWytchEvent, Display, TEXT("  %9.3fs ago  f%-8llu t%-6u %-10s %-7s %s"),
+			Now - Record.Seconds, Record.Frame, Record.ThreadId,
+			GetCategoryName(Record.Category), WytchEventLog::GetLevelName(Record.Level), Record.Text);
+	}
+}
+
+void FWytchEventLog::Clear()
+{
+	using namespace WytchEventLog;
+
+	// Rewinding Head races a concurrent writer; fine for a console command
+	FScopeLock Lock(&RingsLock);
+	for (FRing* Ring : Rings)
+	{
+		Ring->Head.store(0, std::memory_order_release);
+	}
+}
+
+const TCHAR* FWytchEventLog::GetCategoryName(EWytchEventCategory Category)
+{
+	switch (Category)
+	{
+	case EWytchEventCategory::Brain:		return TEXT("Brain");
+	case EWytchEventCategory::Perception:	return TEXT("Perception");
+	case EWytchEventCategory::Foreman:		return TEXT("Foreman");
+	case EWytchEventCategory::Drone:		return TEXT("Drone");
+	default:								return TEXT("?");
+	}
+}
+
+namespace WytchEventLog
+{
+	static FAutoConsoleCommand DumpCommand(
+		TEXT("wytch.events.dump"),
+		TEXT("Prints the most recent events from every thread. Optional args: count (default 64), category (Brain, Perception, Foreman, Drone)."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			int32 Count = 64;
+			EWytchEventCategory Category = EWytchEventCategory::Num;
+			for (const FString& Arg : Args)
+			{
+				if (Arg.IsNumeric())
+				{
+					Count = FCString::Atoi(*Arg);
+					continue;
+				}
+				for (uint8 Index = 0; Index < static_cast<uint8>(EWytchEventCategory::Num); ++Index)
+				{
+					if (Arg.Equals(FWytchEventLog::GetCategoryName(static_cast<EWytchEventCategory>(Index)), ESearchCase::IgnoreCase))
+					{
+						Category = static_cast<EWytchEventCategory>(Index);
+					}
+				}
+			}
+			FWytchEventLog::Dump(Count, Category);
+		}));
+
+	static FAutoConsoleCommand ClearCommand(
+		TEXT("wytch.events.clear"),
+		TEXT("Empties every event ring buffer."),
+		FConsoleCommandDelegate::CreateStatic(&FWytchEventLog::Clear));
+}
+
+#endif // WYTCH_EVENTLOG_ENABLED
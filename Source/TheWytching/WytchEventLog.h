@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// Compiled out of shipping builds unless the target opts back in
+#ifndef WYTCH_EVENTLOG_ENABLED
+	#define WYTCH_EVENTLOG_ENABLED !UE_BUILD_SHIPPING
+#endif
+
+DECLARE_LOG_CATEGORY_EXTERN(LogWytchEvent, Log, All);
+
+enum class EWytchEventCategory : uint8
+{
+	Brain,		// Foreman vision brain: commands, snaps, state changes
+	Perception,	// AI perception updates
+	Foreman,	// StateTree nodes and dispatch
+	Drone,		// Ollama drone pawn: input, snaps, responses
+
+	Num
+};
+
+enum class EWytchEventLevel : uint8
+{
+	Trace,		// per-tick / per-input noise — ring buffer only by default
+	Info,
+	Warning,
+	Error,
+
+	Off
+};
+
+// ─────────────────────────────────────────────────────────
+// FWytchEventRecord — one fixed-size ring-buffer slot
+//   Text is formatted in place and truncated; no heap
+//   allocation on the write path.
+// ─────────────────────────────────────────────────────────
+struct FWytchEventRecord
+{
+	static constexpr int32 MaxText = 116;
+
+	double Seconds = 0.0;		// FPlatformTime::Seconds()
+	uint64 Frame = 0;			// GFrameCounter
+	uint32 ThreadId = 0;
+	EWytchEventCategory Category = EWytchEventCategory::Brain;
+	EWytchEventLevel Level = EWytchEventLevel::Trace;
+	TCHAR Text[MaxText] = {};
+};
+
+// ─────────────────────────────────────────────────────────
+// FWytchEventLog — structured, per-thread ring-buffer event log
+//   Each thread writes into its own ring (single producer, no
+//   lock). Records hold the first MaxText characters; echoed
+//   events reach the log and screen untruncated.
+//   `wytch.events` sets the lowest recorded level,
+//   `wytch.events.echo` the lowest also sent to the output log,
+//   `wytch.events.screen` the lowest also shown on screen.
+//   `wytch.events.dump [Count] [Category]` prints the merged
+//   tail, `wytch.events.clear` empties every ring.
+//   Use WYTCH_EVENT — it skips argument evaluation when the
+//   level is filtered and compiles to nothing in shipping.
+// ─────────────────────────────────────────────────────────
+class THEWYTCHING_API FWytchEventLog
+{
+public:
+	static constexpr int32 RingCapacity = 512;
+
+	/** Backing values of wytch.events, wytch.events.echo and wytch.events.screen. */
+	static int32 MinRecordLevel;
+	static int32 EchoLevel;
+	static int32 ScreenLevel;
+
+	static bool IsEnabled(EWytchEventLevel Level)
+	{
+		return static_cast<int32>(Level) >= MinRecordLevel;
+	}
+
+	/** True if a recorded event at Level is also sent to the output log or the screen. */
+	static bool IsEchoed(EWytchEventLevel Level)
+	{
+		return static_cast<int32>(Level) >= FMath::Min(EchoLevel, ScreenLevel);
+	}
+
+	template <typename FmtType, typename... Types>
+	static void Write(EWytchEventCategory Category, EWytchEventLevel Level, const FmtType& Fmt, Types... Args)
+	{
+		FWytchEventRecord& Record = BeginRecord(Category, Level);
+		if (IsEchoed(Level))
+		{
+			// Echoed events are off the per-tick path — the log and screen get the full text
+			const FString Text = FString::Printf(Fmt, Args...);
+			FCString::Strncpy(Record.Text, *Text, FWytchEventRecord::MaxText);
+			CommitRecord(Record, *Text);
+		}
+		else
+		{
+			FCString::Snprintf(Record.Text, FWytchEventRecord::MaxText, Fmt, Args...);
+			CommitRecord(Record, Record.Text);
+		}
+	}
+
+	/** Most recent records across every thread, oldest first. */
+	static TArray<FWytchEventRecord> GetRecent(int32 MaxCount, EWytchEventCategory Category = EWytchEventCategory::Num);
+
+	static void Dump(int32 MaxCount, EWytchEventCategory Category = EWytchEventCategory::Num);
+	static void Clear();
+
+	static const TCHAR* GetCategoryName(EWytchEventCategory Category);
+
+private:
+	static FWytchEventRecord& BeginRecord(EWytchEventCategory Category, EWytchEventLevel Level);
+	static void CommitRecord(const FWytchEventRecord& Record, const TCHAR* Text);
+};
+
+#if WYTCH_EVENTLOG_ENABLED
+	#define WYTCH_EVENT(Category, Level, Format, ...) \
+		do \
+		{ \
+			if (FWytchEventLog::IsEnabled(EWytchEventLevel::Level)) \
+			{ \
+				FWytchEventLog::Write(EWytchEventCategory::Category, EWytchEventLevel::Level, Format, ##__VA_ARGS__); \
+			} \
+		} while (0)
+#else
+	#define WYTCH_EVENT(Category, Level, Format, ...) do {} while (0)
+#endif
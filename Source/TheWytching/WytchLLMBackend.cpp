@@ -0,0 +1,101 @@
+#include "WytchLLMBackend.h"
+
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Json.h"
+
+namespace WytchLLMBackend
+{
+	static FString BackendName = TEXT("http");
+	static FAutoConsoleVariableRef CVarBackend(
+		TEXT("wytch.llm.backend"),
+		BackendName,
+		TEXT("LLM backend for Foreman brains created after the change: http (default) or mock."));
+}
+
+TSharedRef<IWytchLLMBackend> IWytchLLMBackend::CreateDefault()
+{
+	if (FParse::Param(FCommandLine::Get(), TEXT("WytchMockLLM"))
+		|| WytchLLMBackend::BackendName.Equals(TEXT("mock"), ESearchCase::IgnoreCase))
+	{
+		return MakeShared<FWytchMockLLMBackend>();
+	}
+	return MakeShared<FWytchHttpLLMBackend>();
+}
+
+// ─────────────────────────────────────────────────────────
+// FWytchHttpLLMBackend
+// ─────────────────────────────────────────────────────────
+
+void FWytchHttpLLMBackend::Send(const FWytchLLMRequest& Request, FOnWytchLLMResponse OnResponse)
+{
+	FHttpRequestRef HttpRequest = FHttpModule::Get().CreateRequest();
+	HttpRequest->SetURL(Request.URL);
+	HttpRequest->SetVerb(TEXT("POST"));
+	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	HttpRequest->SetContentAsString(Request.Body);
+	HttpRequest->OnProcessRequestComplete().BindLambda(
+		[OnResponse](FHttpRequestPtr Completed, FHttpResponsePtr Response, bool bWasSuccessful)
+		{
+			FWytchLLMResponse Result;
+			Result.bSuccess = bWasSuccessful && Response.IsValid();
+			Result.Content = Response.IsValid() ? Response->GetContentAsString() : FString();
+			Result.NetworkSeconds = Completed.IsValid() ? Completed->GetElapsedTime() : 0.0;
+			OnResponse.ExecuteIfBound(Result);
+		});
+	HttpRequest->ProcessRequest();
+}
+
+// ─────────────────────────────────────────────────────────
+// FWytchMockLLMBackend
+// ─────────────────────────────────────────────────────────
+
+void FWytchMockLLMBackend::Send(const FWytchLLMRequest& Request, FOnWytchLLMResponse OnResponse)
+{
+	++NumRequests;
+	LastRequest = Request;
+
+	// Answer now, deliver later — the brain must never see a re-entrant response
+	FWytchLLMResponse Result;
+	Result.bSuccess = !bFail;
+	Result.NetworkSeconds = LatencySeconds;
+	if (Result.bSuccess)
+	{
+		Result.Content = MakeChatCompletion(Responder
+			? Responder(Request)
+			: TEXT("{\"summary\":\"mock: nothing found\",\"target_found\":false,\"target_tag\":\"\",")
+			  TEXT("\"action\":{\"action\":\"wait\",\"target\":\"\",\"direction\":\"\",\"speed\":\"\"}}"));
+	}
+
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+		[OnResponse, Result](float)
+		{
+			OnResponse.ExecuteIfBound(Result);
+			return false;
+		}), static_cast<float>(LatencySeconds));
+}
+
+FString FWytchMockLLMBackend::MakeChatCompletion(const FString& MessageContent)
+{
+	TSharedRef<FJsonObject> Message = MakeShared<FJsonObject>();
+	Message->SetStringField(TEXT("role"), TEXT("assistant"));
+	Message->SetStringField(TEXT("content"), MessageContent);
+
+	TSharedRef<FJsonObject> Choice = MakeShared<FJsonObject>();
+	Choice->SetNumberField(TEXT("index"), 0);
+	Choice->SetObjectField(TEXT("message"), Message);
+
+	TSharedRef<FJsonObject> Outer = MakeShared<FJsonObject>();
+	Outer->SetStringField(TEXT("model"), TEXT("mock"));
+	Outer->SetArrayField(TEXT("choices"), { MakeShared<FJsonValueObject>(Choice) });
+
+	FString Out;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Out);
+	FJsonSerializer::Serialize(Outer, Writer);
+	return Out;
+}
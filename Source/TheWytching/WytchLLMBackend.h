@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// ─────────────────────────────────────────────────────────
+// LLM backend seam
+//   The Foreman brain sends one chat-completion request per snap
+//   through an IWytchLLMBackend. FWytchHttpLLMBackend talks to the
+//   real endpoint; FWytchMockLLMBackend answers locally so the
+//   brain runs headless (-nullrhi, automation) with no server.
+//   Pick the default with `wytch.llm.backend http|mock` or the
+//   -WytchMockLLM command-line switch.
+// ─────────────────────────────────────────────────────────
+
+struct FWytchLLMRequest
+{
+	FString URL;
+
+	/** Full chat-completion JSON body. */
+	FString Body;
+
+	/** The inputs Body was built from, kept separately for session recording. */
+	FString Command;
+	FString Context;
+	FString ImageBase64;
+};
+
+struct FWytchLLMResponse
+{
+	bool bSuccess = false;
+
+	/** Raw response body — the chat-completion JSON, not just the message content. */
+	FString Content;
+
+	/** Time spent in the backend itself (HTTP elapsed time, mock latency). */
+	double NetworkSeconds = 0.0;
+};
+
+/** Fires on the game thread, exactly once per Send. */
+DECLARE_DELEGATE_OneParam(FOnWytchLLMResponse, const FWytchLLMResponse& /*Response*/);
+
+class THEWYTCHING_API IWytchLLMBackend : public TSharedFromThis<IWytchLLMBackend>
+{
+public:
+	virtual ~IWytchLLMBackend() = default;
+
+	virtual void Send(const FWytchLLMRequest& Request, FOnWytchLLMResponse OnResponse) = 0;
+
+	/** False when the backend ignores the image — the brain then sends without capturing. */
+	virtual bool WantsImage() const { return true; }
+
+	/** The backend selected by wytch.llm.backend / -WytchMockLLM. */
+	static TSharedRef<IWytchLLMBackend> CreateDefault();
+};
+
+class THEWYTCHING_API FWytchHttpLLMBackend : public IWytchLLMBackend
+{
+public:
+	virtual void Send(const FWytchLLMRequest& Request, FOnWytchLLMResponse OnResponse) override;
+};
+
+class THEWYTCHING_API FWytchMockLLMBackend : public IWytchLLMBackend
+{
+public:
+	/**
+	 * Returns the assistant message content (the brain's inner JSON) for a request.
+	 * Unset = "nothing found, wait".
+	 */
+	TFunction<FString(const FWytchLLMRequest&)> Responder;
+
+	/** Seconds before the response fires. 0 = next core tick. */
+	double LatencySeconds = 0.0;
+
+	/** Answer every request as a failed transport. */
+	bool bFail = false;
+
+	int32 GetNumRequests() const { return NumRequests; }
+	const FWytchLLMRequest& GetLastRequest() const { return LastRequest; }
+
+	virtual void Send(const FWytchLLMRequest& Request, FOnWytchLLMResponse OnResponse) override;
+	virtual bool WantsImage() const override { return false; }
+
+	/** Wraps message content in an OpenAI-style chat-completion body. */
+	static FString MakeChatCompletion(const FString& MessageContent);
+
+private:
+	int32 NumRequests = 0;
+	FWytchLLMRequest LastRequest;
+};
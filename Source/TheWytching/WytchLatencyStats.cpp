@@ -0,0 +1,218 @@
+#include "WytchLatencyStats.h"
+
+#include "ForemanTypes.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+// ─────────────────────────────────────────────────────────
+// FWytchLatencyHistogram
+// ─────────────────────────────────────────────────────────
+
+FWytchLatencyHistogram::FWytchLatencyHistogram()
+{
+	Reset();
+}
+
+int32 FWytchLatencyHistogram::GetBucket(uint64 Micros)
+{
+	if (Micros < SubBucketCount)
+	{
+		return static_cast<int32>(Micros);
+	}
+
+	// Top SubBucketBits+1 bits pick the bucket; everything below is rounded away
+	const int32 Shift = FMath::Min(static_cast<int32>(FPlatformMath::FloorLog2_64(Micros)) - SubBucketBits, MaxShift);
+	const int32 SubBucket = static_cast<int32>(FMath::Min<uint64>(Micros >> Shift, 2 * SubBucketCount - 1)) - SubBucketCount;
+	return SubBucketCount * (Shift + 1) + SubBucket;
+}
+
+uint64 FWytchLatencyHistogram::GetBucketValue(int32 Bucket)
+{
+	if (Bucket < SubBucketCount)
+	{
+		return static_cast<uint64>(Bucket);
+	}
+
+	const int32 Shift = Bucket / SubBucketCount - 1;
+	const uint64 Lower = static_cast<uint64>(SubBucketCount + Bucket % SubBucketCount) << Shift;
+	return Lower + ((uint64(1) << Shift) >> 1);
+}
+
+void FWytchLatencyHistogram::Record(double Seconds)
+{
+	const uint64 Micros = static_cast<uint64>(FMath::Max(Seconds, 0.0) * 1000000.0);
+
+	Buckets[GetBucket(Micros)].fetch_add(1, std::memory_order_relaxed);
+	Count.fetch_add(1, std::memory_order_relaxed);
+	SumMicros.fetch_add(Micros, std::memory_order_relaxed);
+
+	uint64 Max = MaxMicros.load(std::memory_order_relaxed);
+	while (Micros > Max && !MaxMicros.compare_exchange_weak(Max, Micros, std::memory_order_relaxed))
+	{
+	}
+}
+
+void FWytchLatencyHistogram::Reset()
+{
+	for (std::atomic<uint64>& Bucket : Buckets)
+	{
+		Bucket.store(0, std::memory_order_relaxed);
+	}
+	Count.store(0, std::memory_order_relaxed);
+	SumMicros.store(0, std::memory_order_relaxed);
+	MaxMicros.store(0, std::memory_order_relaxed);
+}
+
+FWytchLatencyHistogram::FSummary FWytchLatencyHistogram::Summarize() const
+{
+	// Snapshot the buckets first — the total comes from them so percentiles stay consistent under concurrent records
+	uint64 Snapshot[NumBuckets];
+	uint64 Total = 0;
+	for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+	{
+		Snapshot[Bucket] = Buckets[Bucket].load(std::memory_order_relaxed);
+		Total += Snapshot[Bucket];
+	}
+
+	FSummary Summary;
+	Summary.Count = Total;
+	if (Total == 0)
+	{
+		return Summary;
+	}
+
+	const uint64 Recorded = FMath::Max<uint64>(Count.load(std::memory_order_relaxed), 1);
+	Summary.MeanSeconds = SumMicros.load(std::memory_order_relaxed) / static_cast<double>(Recorded) / 1000000.0;
+	Summary.MaxSeconds = MaxMicros.load(std::memory_order_relaxed) / 1000000.0;
+
+	const uint64 Ranks[] = { (Total * 50 + 99) / 100, (Total * 90 + 99) / 100, (Total * 99 + 99) / 100 };
+	double* Outputs[] = { &Summary.P50Seconds, &Summary.P90Seconds, &Summary.P99Seconds };
+
+	uint64 Seen = 0;
+	int32 Next = 0;
+	for (int32 Bucket = 0; Bucket < NumBuckets && Next < UE_ARRAY_COUNT(Ranks); ++Bucket)
+	{
+		Seen += Snapshot[Bucket];
+		while (Next < UE_ARRAY_COUNT(Ranks) && Seen >= FMath::Max<uint64>(Ranks[Next], 1))
+		{
+			// A bucket midpoint can overshoot the true max — never report past it
+			*Outputs[Next] = FMath::Min(GetBucketValue(Bucket) / 1000000.0, Summary.MaxSeconds);
+			++Next;
+		}
+	}
+	return Summary;
+}
+
+// ─────────────────────────────────────────────────────────
+// FWytchLatencyStats
+// ─────────────────────────────────────────────────────────
+
+namespace WytchLatencyStats
+{
+	static FWytchLatencyHistogram Histograms[static_cast<int32>(EWytchLatencyStage::Num)];
+}
+
+void FWytchLatencyStats::Record(EWytchLatencyStage Stage, double Seconds)
+{
+	Get(Stage).Record(Seconds);
+}
+
+FWytchLatencyHistogram& FWytchLatencyStats::Get(EWytchLatencyStage Stage)
+{
+	check(Stage < EWytchLatencyStage::Num);
+	return WytchLatencyStats::Histograms[static_cast<int32>(Stage)];
+}
+
+const TCHAR* FWytchLatencyStats::GetStageName(EWytchLatencyStage Stage)
+{
+	switch (Stage)
+	{
+	case EWytchLatencyStage::BrainCapture:		return TEXT("Brain.Capture");
+	case EWytchLatencyStage::BrainEncode:		return TEXT("Brain.Encode");
+	case EWytchLatencyStage::BrainQueueWait:	return TEXT("Brain.QueueWait");
+	case EWytchLatencyStage::BrainNetwork:		return TEXT("Brain.Network");
+	case EWytchLatencyStage::BrainParse:		return TEXT("Brain.Parse");
+	case EWytchLatencyStage::BrainActionStart:	return TEXT("Brain.ActionStart");
+	case EWytchLatencyStage::JobAssign:			return TEXT("Job.Assign");
+	case EWytchLatencyStage::JobTravel:			return TEXT("Job.Travel");
+	case EWytchLatencyStage::JobWork:			return TEXT("Job.Work");
+	default:									return TEXT("Unknown");
+	}
+}
+
+void FWytchLatencyStats::Dump()
+{
+	UE_LOG(LogForeman, Display, TEXT("%-18s %8s %10s %10s %10s %10s %10s"),
+		TEXT("stage"), TEXT("count"), TEXT("mean ms"), TEXT("p50 ms"), TEXT("p90 ms"), TEXT("p99 ms"), TEXT("max ms"));
+
+	for (int32 Index = 0; Index < static_cast<int32>(EWytchLatencyStage::Num); ++Index)
+	{
+		const EWytchLatencyStage Stage = static_cast<EWytchLatencyStage>(Index);
+		const FWytchLatencyHistogram::FSummary Summary = Get(Stage).Summarize();
+		UE_LOG(LogForeman, Display, TEXT("%-18s %8llu %10.2f %10.2f %10.2f %10.2f %10.2f"),
+			GetStageName(Stage), Summary.Count,
+			Summary.MeanSeconds * 1000.0, Summary.P50Seconds * 1000.0, Summary.P90Seconds * 1000.0,
+			Summary.P99Seconds * 1000.0, Summary.MaxSeconds * 1000.0);
+	}
+}
+
+FString FWytchLatencyStats::ExportCsv(const FString& FilePath)
+{
+	const FString Timestamp = FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S"));
+	const FString Path = FilePath.IsEmpty()
+		? FPaths::Combine(FPaths::ProfilingDir(), TEXT("WytchStats"), FString::Printf(TEXT("WytchStats-%s.csv"), *Timestamp))
+		: FilePath;
+
+	// Build + time on every row so files from different builds concatenate cleanly
+	FString Csv = TEXT("Build,Timestamp,Stage,Count,MeanMs,P50Ms,P90Ms,P99Ms,MaxMs\n");
+	for (int32 Index = 0; Index < static_cast<int32>(EWytchLatencyStage::Num); ++Index)
+	{
+		const EWytchLatencyStage Stage = static_cast<EWytchLatencyStage>(Index);
+		const FWytchLatencyHistogram::FSummary Summary = Get(Stage).Summarize();
+		Csv += FString::Printf(TEXT("%s,%s,%s,%llu,%.3f,%.3f,%.3f,%.3f,%.3f\n"),
+			FApp::GetBuildVersion(), *Timestamp, GetStageName(Stage), Summary.Count,
+			Summary.MeanSeconds * 1000.0, Summary.P50Seconds * 1000.0, Summary.P90Seconds * 1000.0,
+			Summary.P99Seconds * 1000.0, Summary.MaxSeconds * 1000.0);
+	}
+
+	if (!FFileHelper::SaveStringToFile(Csv, *Path))
+	{
+		UE_LOG(LogForeman, Warning, TEXT("wytch.stats.csv: could not write %s"), *Path);
+		return FString();
+	}
+
+	UE_LOG(LogForeman, Display, TEXT("wytch.stats.csv: wrote %s"), *Path);
+	return Path;
+}
+
+void FWytchLatencyStats::ResetAll()
+{
+	for (FWytchLatencyHistogram& Histogram : WytchLatencyStats::Histograms)
+	{
+		Histogram.Reset();
+	}
+}
+
+namespace WytchLatencyStats
+{
+	static FAutoConsoleCommand DumpCommand(
+		TEXT("wytch.stats"),
+		TEXT("Dumps p50/p90/p99/max and counts for every brain and dispatch latency stage."),
+		FConsoleCommandDelegate::CreateStatic(&FWytchLatencyStats::Dump));
+
+	static FAutoConsoleCommand CsvCommand(
+		TEXT("wytch.stats.csv"),
+		TEXT("Writes the latency summary as CSV. Optional arg: file path (default Saved/Profiling/WytchStats/)."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			FWytchLatencyStats::ExportCsv(Args.Num() > 0 ? Args[0] : FString());
+		}));
+
+	static FAutoConsoleCommand ResetCommand(
+		TEXT("wytch.stats.reset"),
+		TEXT("Clears every latency histogram."),
+		FConsoleCommandDelegate::CreateStatic(&FWytchLatencyStats::ResetAll));
+}
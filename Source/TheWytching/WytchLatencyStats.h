@@ -0,0 +1,110 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// ─────────────────────────────────────────────────────────
+// EWytchLatencyStage — every always-on latency we track
+// ─────────────────────────────────────────────────────────
+enum class EWytchLatencyStage : uint8
+{
+	// Foreman brain, per snap
+	BrainCapture,		// CaptureScene + render-target readback
+	BrainEncode,		// PNG encode + Base64
+	BrainQueueWait,		// request sent → HTTP started it, plus completion dispatch
+	BrainNetwork,		// HTTP request elapsed time
+	BrainParse,			// response JSON → command
+	BrainActionStart,	// response received → move order issued
+
+	// Foreman dispatch, per job
+	JobAssign,			// job created → worker assigned
+	JobTravel,			// assigned → worker arrived (Working)
+	JobWork,			// arrived → job complete
+
+	Num
+};
+
+// ─────────────────────────────────────────────────────────
+// FWytchLatencyHistogram — lock-free log-linear histogram
+//   HDR-style: values in microseconds, exact below 16 µs, then
+//   16 sub-buckets per power of two (≤ 6.25% relative error) up to
+//   ~12 days. Record is a handful of relaxed atomic adds, so any
+//   thread can record without a lock; readers see a slightly
+//   racy but never torn view.
+// ─────────────────────────────────────────────────────────
+class THEWYTCHING_API FWytchLatencyHistogram
+{
+public:
+	static constexpr int32 SubBucketBits = 4;
+	static constexpr int32 SubBucketCount = 1 << SubBucketBits;
+	static constexpr int32 MaxShift = 36;
+	static constexpr int32 NumBuckets = SubBucketCount * (MaxShift + 2);
+
+	struct FSummary
+	{
+		uint64 Count = 0;
+		double MeanSeconds = 0.0;
+		double P50Seconds = 0.0;
+		double P90Seconds = 0.0;
+		double P99Seconds = 0.0;
+		double MaxSeconds = 0.0;
+	};
+
+	FWytchLatencyHistogram();
+
+	void Record(double Seconds);
+	void Reset();
+	FSummary Summarize() const;
+
+private:
+	static int32 GetBucket(uint64 Micros);
+
+	/** Midpoint of the bucket's value range, in microseconds. */
+	static uint64 GetBucketValue(int32 Bucket);
+
+	std::atomic<uint64> Buckets[NumBuckets];
+	std::atomic<uint64> Count;
+	std::atomic<uint64> SumMicros;
+	std::atomic<uint64> MaxMicros;
+};
+
+// ─────────────────────────────────────────────────────────
+// FWytchLatencyStats — one histogram per stage
+//   `wytch.stats` dumps p50/p90/p99/max and counts,
+//   `wytch.stats.csv [File]` writes the same for comparing builds,
+//   `wytch.stats.reset` clears every histogram.
+// ─────────────────────────────────────────────────────────
+class THEWYTCHING_API FWytchLatencyStats
+{
+public:
+	static void Record(EWytchLatencyStage Stage, double Seconds);
+	static FWytchLatencyHistogram& Get(EWytchLatencyStage Stage);
+	static const TCHAR* GetStageName(EWytchLatencyStage Stage);
+
+	static void Dump();
+
+	/** Writes every stage's summary as CSV. Returns the file written, empty on failure. */
+	static FString ExportCsv(const FString& FilePath = FString());
+
+	static void ResetAll();
+};
+
+/** Records the time until the end of the enclosing scope against a stage. */
+class FWytchLatencyTimer
+{
+public:
+	explicit FWytchLatencyTimer(EWytchLatencyStage InStage)
+		: Stage(InStage)
+		, StartSeconds(FPlatformTime::Seconds())
+	{
+	}
+
+	~FWytchLatencyTimer()
+	{
+		FWytchLatencyStats::Record(Stage, FPlatformTime::Seconds() - StartSeconds);
+	}
+
+private:
+	EWytchLatencyStage Stage;
+	double StartSeconds;
+};
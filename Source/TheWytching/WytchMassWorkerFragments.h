@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassEntityTypes.h"
+#include "SmartObjectRuntime.h"
+#include "AndroidTypes.h"
+#include "WytchCapabilityMask.h"
+#include "WytchMassWorkerFragments.generated.h"
+
+class AActor;
+class AAutoBot_Character;
+
+// ─────────────────────────────────────────────────────────
+// Mass worker fragments — the entity form of an AutoBot
+//   An entity carries what the Foreman dispatches on (state,
+//   power, capability mask) plus its current task. While it is
+//   promoted to an AAutoBot_Character (FWytchWorkerActorTag) the
+//   actor is authoritative and the Mass processors skip it.
+// ─────────────────────────────────────────────────────────
+
+/** Dispatch-relevant worker state. Mirrors UAndroidConditionComponent while unpromoted. */
+USTRUCT()
+struct FWytchWorkerFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	EWorkerState State = EWorkerState::Idle;
+
+	/** 0.0 = dead, 1.0 = full. */
+	float PowerLevel = 1.f;
+
+	/** Power drain per second — from the actor class defaults. */
+	float PowerDrainRate = 0.f;
+
+	/** Worker mask (tags plus parents) — FWytchCapabilityRegistry::MakeWorkerMask. */
+	FWytchCapabilityMask Capabilities;
+};
+
+/** Current SmartObject task and the straight-line move toward it. */
+USTRUCT()
+struct FWytchWorkerTaskFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	FSmartObjectSlotHandle SlotHandle;
+
+	/** Held from dispatch so the slot leaves the free index while the entity travels. */
+	FSmartObjectClaimHandle ClaimHandle;
+
+	TWeakObjectPtr<AActor> TargetActor;
+
+	FVector Destination = FVector::ZeroVector;
+	float AcceptanceRadius = 80.f;
+
+	/** World units per second — the actor class's MaxWalkSpeed. */
+	float MoveSpeed = 300.f;
+
+	bool bMoving = false;
+
+	/** Reached Destination — promotion picks it up to start the work interaction. */
+	bool bArrived = false;
+
+	bool HasTask() const { return SlotHandle.IsValid(); }
+};
+
+/** Actor class to promote to, and the live actor while promoted. */
+USTRUCT()
+struct FWytchWorkerActorFragment : public FMassFragment
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<AAutoBot_Character> ActorClass;
+
+	TWeakObjectPtr<AAutoBot_Character> Actor;
+};
+
+/** Every AutoBot entity. */
+USTRUCT()
+struct FWytchWorkerTag : public FMassTag
+{
+	GENERATED_BODY()
+};
+
+/** Entity is represented by a live AAutoBot_Character — processors leave it alone. */
+USTRUCT()
+struct FWytchWorkerActorTag : public FMassTag
+{
+	GENERATED_BODY()
+};
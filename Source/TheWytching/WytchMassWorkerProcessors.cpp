@@ -0,0 +1,100 @@
+#include "WytchMassWorkerProcessors.h"
+
+#include "WytchMassWorkerFragments.h"
+#include "MassCommonFragments.h"
+#include "MassExecutionContext.h"
+
+// ─────────────────────────────────────────────────────────
+// UWytchWorkerMoveProcessor
+// ─────────────────────────────────────────────────────────
+
+UWytchWorkerMoveProcessor::UWytchWorkerMoveProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = (int32)EProcessorExecutionFlags::AllNetModes;
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	bAutoRegisterWithProcessingPhases = true;
+}
+
+void UWytchWorkerMoveProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddRequirement<FTransformFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddRequirement<FWytchWorkerTaskFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddTagRequirement<FWytchWorkerTag>(EMassFragmentPresence::All);
+	EntityQuery.AddTagRequirement<FWytchWorkerActorTag>(EMassFragmentPresence::None);
+}
+
+void UWytchWorkerMoveProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	EntityQuery.ForEachEntityChunk(Context, [](FMassExecutionContext& Context)
+	{
+		const float DeltaTime = Context.GetDeltaTimeSeconds();
+		const TArrayView<FTransformFragment> Transforms = Context.GetMutableFragmentView<FTransformFragment>();
+		const TArrayView<FWytchWorkerTaskFragment> Tasks = Context.GetMutableFragmentView<FWytchWorkerTaskFragment>();
+
+		for (int32 Index = 0; Index < Context.GetNumEntities(); ++Index)
+		{
+			FWytchWorkerTaskFragment& Task = Tasks[Index];
+			if (!Task.bMoving) continue;
+
+			FTransform& Transform = Transforms[Index].GetMutableTransform();
+			const FVector Location = Transform.GetLocation();
+			const FVector ToGoal = Task.Destination - Location;
+			const float Distance = ToGoal.Size();
+			const float Step = Task.MoveSpeed * DeltaTime;
+
+			if (Distance - Step <= Task.AcceptanceRadius)
+			{
+				// Stop on the acceptance ring, not on the slot itself
+				const float Travel = FMath::Max(Distance - Task.AcceptanceRadius, 0.f);
+				Transform.SetLocation(Distance > KINDA_SMALL_NUMBER ? Location + ToGoal / Distance * Travel : Location);
+				Task.bMoving = false;
+				Task.bArrived = true;
+				continue;
+			}
+
+			const FVector Direction = ToGoal / Distance;
+			Transform.SetLocation(Location + Direction * Step);
+			Transform.SetRotation(Direction.ToOrientationQuat());
+		}
+	});
+}
+
+// ─────────────────────────────────────────────────────────
+// UWytchWorkerPowerProcessor
+// ─────────────────────────────────────────────────────────
+
+UWytchWorkerPowerProcessor::UWytchWorkerPowerProcessor()
+	: EntityQuery(*this)
+{
+	ExecutionFlags = (int32)EProcessorExecutionFlags::AllNetModes;
+	ProcessingPhase = EMassProcessingPhase::PrePhysics;
+	bAutoRegisterWithProcessingPhases = true;
+}
+
+void UWytchWorkerPowerProcessor::ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager)
+{
+	EntityQuery.AddRequirement<FWytchWorkerFragment>(EMassFragmentAccess::ReadWrite);
+	EntityQuery.AddTagRequirement<FWytchWorkerTag>(EMassFragmentPresence::All);
+	EntityQuery.AddTagRequirement<FWytchWorkerActorTag>(EMassFragmentPresence::None);
+}
+
+void UWytchWorkerPowerProcessor::Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context)
+{
+	EntityQuery.ForEachEntityChunk(Context, [](FMassExecutionContext& Context)
+	{
+		const float DeltaTime = Context.GetDeltaTimeSeconds();
+		const TArrayView<FWytchWorkerFragment> Workers = Context.GetMutableFragmentView<FWytchWorkerFragment>();
+
+		for (FWytchWorkerFragment& Worker : Workers)
+		{
+			if (Worker.PowerLevel <= 0.f) continue;
+
+			Worker.PowerLevel = FMath::Max(Worker.PowerLevel - Worker.PowerDrainRate * DeltaTime, 0.f);
+			if (Worker.PowerLevel <= 0.f)
+			{
+				Worker.State = EWorkerState::Unavailable;
+			}
+		}
+	});
+}
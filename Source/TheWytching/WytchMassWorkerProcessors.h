@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MassProcessor.h"
+#include "MassEntityQuery.h"
+#include "WytchMassWorkerProcessors.generated.h"
+
+/**
+ * Moves unpromoted AutoBot entities straight toward their task slot and
+ * flags arrival. Entities are off-screen stand-ins — the actor they promote
+ * into does the navmesh pathing and the final approach.
+ */
+UCLASS()
+class THEWYTCHING_API UWytchWorkerMoveProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UWytchWorkerMoveProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
+
+/**
+ * Drains power on unpromoted AutoBot entities at their class drain rate.
+ * An entity at zero power turns Unavailable, as a Dead actor would.
+ */
+UCLASS()
+class THEWYTCHING_API UWytchWorkerPowerProcessor : public UMassProcessor
+{
+	GENERATED_BODY()
+
+public:
+	UWytchWorkerPowerProcessor();
+
+protected:
+	virtual void ConfigureQueries(const TSharedRef<FMassEntityManager>& EntityManager) override;
+	virtual void Execute(FMassEntityManager& EntityManager, FMassExecutionContext& Context) override;
+
+private:
+	FMassEntityQuery EntityQuery;
+};
@@ -0,0 +1,391 @@
+#include "WytchMassWorkerSubsystem.h"
+
+#include "WytchingStats.h"
+#include "WytchMassWorkerFragments.h"
+#include "AutoBot_Character.h"
+#include "AndroidConditionComponent.h"
+#include "IWytchCommandable.h"
+#include "MassEntitySubsystem.h"
+#include "MassEntityManager.h"
+#include "MassCommonFragments.h"
+#include "SmartObjectSubsystem.h"
+#include "StructView.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+UWytchMassWorkerSubsystem* UWytchMassWorkerSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UWytchMassWorkerSubsystem>() : nullptr;
+}
+
+bool UWytchMassWorkerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWytchMassWorkerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	Collection.InitializeDependency<UMassEntitySubsystem>();
+}
+
+void UWytchMassWorkerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	InWorld.GetTimerManager().SetTimer(UpdateTimerHandle, this,
+		&UWytchMassWorkerSubsystem::UpdateRepresentation, UpdateInterval, /*bLoop=*/true);
+}
+
+void UWytchMassWorkerSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(UpdateTimerHandle);
+	}
+
+	// Entities are going away with the world — don't leave their slots claimed
+	TArray<FMassEntityHandle> Claimants;
+	Claims.GetKeys(Claimants);
+	for (const FMassEntityHandle Entity : Claimants)
+	{
+		ReleaseClaim(Entity);
+	}
+
+	Entities.Reset();
+	ActorToEntity.Reset();
+	IdleEntities.Reset();
+
+	Super::Deinitialize();
+}
+
+FMassEntityManager* UWytchMassWorkerSubsystem::GetEntityManager() const
+{
+	UMassEntitySubsystem* EntitySubsystem = GetWorld()->GetSubsystem<UMassEntitySubsystem>();
+	return EntitySubsystem ? &EntitySubsystem->GetMutableEntityManager() : nullptr;
+}
+
+// ─────────────────────────────────────────────────────────
+// Spawning
+// ─────────────────────────────────────────────────────────
+
+int32 UWytchMassWorkerSubsystem::SpawnWorkers(TSubclassOf<AAutoBot_Character> ActorClass, const TArray<FTransform>& Transforms)
+{
+	int32 Spawned = 0;
+	for (const FTransform& Transform : Transforms)
+	{
+		Spawned += SpawnWorker(ActorClass, Transform).IsSet() ? 1 : 0;
+	}
+
+	UE_LOG(LogWytchWorker, Log, TEXT("MassWorkers: spawned %d %s entities (%d total)"),
+		Spawned, *GetNameSafe(ActorClass), Entities.Num());
+	return Spawned;
+}
+
+FMassEntityHandle UWytchMassWorkerSubsystem::SpawnWorker(TSubclassOf<AAutoBot_Character> ActorClass, const FTransform& Transform)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || !ActorClass) return FMassEntityHandle();
+
+	if (!WorkerArchetype.IsValid())
+	{
+		const UScriptStruct* Composition[] =
+		{
+			FTransformFragment::StaticStruct(),
+			FWytchWorkerFragment::StaticStruct(),
+			FWytchWorkerTaskFragment::StaticStruct(),
+			FWytchWorkerActorFragment::StaticStruct(),
+			FWytchWorkerTag::StaticStruct()
+		};
+		WorkerArchetype = EntityManager->CreateArchetype(MakeArrayView(Composition));
+	}
+
+	// Entity defaults come from the class the entity promotes into
+	const AAutoBot_Character* Defaults = ActorClass->GetDefaultObject<AAutoBot_Character>();
+	FGameplayTagContainer Capabilities = Defaults->SpecialistCapabilities;
+
+	const FMassEntityHandle Entity = EntityManager->CreateEntity(WorkerArchetype);
+	EntityManager->GetFragmentDataChecked<FTransformFragment>(Entity).SetTransform(Transform);
+
+	FWytchWorkerFragment& Worker = EntityManager->GetFragmentDataChecked<FWytchWorkerFragment>(Entity);
+	if (const UAndroidConditionComponent* Condition = Defaults->GetCondition())
+	{
+		Capabilities.AppendTags(Condition->BaseCapabilities);
+		Worker.PowerLevel = Condition->PowerLevel;
+		Worker.PowerDrainRate = Condition->PowerDrainRate;
+	}
+	Worker.Capabilities = FWytchCapabilityRegistry::Get().MakeWorkerMask(Capabilities);
+
+	FWytchWorkerTaskFragment& Task = EntityManager->GetFragmentDataChecked<FWytchWorkerTaskFragment>(Entity);
+	Task.AcceptanceRadius = Defaults->ArrivalAcceptanceRadius;
+	if (const UCharacterMovementComponent* Movement = Defaults->GetCharacterMovement())
+	{
+		Task.MoveSpeed = Movement->MaxWalkSpeed;
+	}
+
+	EntityManager->GetFragmentDataChecked<FWytchWorkerActorFragment>(Entity).ActorClass = ActorClass;
+
+	Entities.Add(Entity);
+	IdleEntities.Add(Entity);
+	return Entity;
+}
+
+void UWytchMassWorkerSubsystem::ReleaseClaim(FMassEntityHandle Entity)
+{
+	FSmartObjectClaimHandle ClaimHandle;
+	if (!Claims.RemoveAndCopyValue(Entity, ClaimHandle)) return;
+
+	if (USmartObjectSubsystem* SOSub = USmartObjectSubsystem::GetCurrent(GetWorld()))
+	{
+		SOSub->MarkSlotAsFree(ClaimHandle);
+	}
+}
+
+// ─────────────────────────────────────────────────────────
+// Dispatch — read by the Foreman
+// ─────────────────────────────────────────────────────────
+
+FMassEntityHandle UWytchMassWorkerSubsystem::FindIdleWorker(const FBox& Zone, const FWytchCapabilityMask& Required,
+	const FVector& Location) const
+{
+	const FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager) return FMassEntityHandle();
+
+	FMassEntityHandle Best;
+	double BestDistSq = TNumericLimits<double>::Max();
+
+	for (const FMassEntityHandle Entity : IdleEntities)
+	{
+		if (!EntityManager->IsEntityValid(Entity)) continue;
+
+		const FWytchWorkerFragment& Worker = EntityManager->GetFragmentDataChecked<FWytchWorkerFragment>(Entity);
+		if (Worker.State != EWorkerState::Idle || !Worker.Capabilities.Covers(Required)) continue;
+
+		const FVector EntityLocation = EntityManager->GetFragmentDataChecked<FTransformFragment>(Entity).GetTransform().GetLocation();
+		if (!Zone.IsInsideXY(EntityLocation)) continue;
+
+		const double DistSq = FVector::DistSquared(EntityLocation, Location);
+		if (DistSq < BestDistSq)
+		{
+			BestDistSq = DistSq;
+			Best = Entity;
+		}
+	}
+	return Best;
+}
+
+bool UWytchMassWorkerSubsystem::AssignWorker(FMassEntityHandle Entity, FSmartObjectSlotHandle SlotHandle,
+	AActor* TargetActor, const FVector& Destination)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	USmartObjectSubsystem* SOSub = USmartObjectSubsystem::GetCurrent(GetWorld());
+	if (!EntityManager || !SOSub || !EntityManager->IsEntityValid(Entity)) return false;
+
+	FWytchWorkerFragment& Worker = EntityManager->GetFragmentDataChecked<FWytchWorkerFragment>(Entity);
+	FWytchWorkerTaskFragment& Task = EntityManager->GetFragmentDataChecked<FWytchWorkerTaskFragment>(Entity);
+	if (Worker.State != EWorkerState::Idle || Task.HasTask()) return false;
+	if (!EntityManager->GetFragmentDataChecked<FWytchWorkerActorFragment>(Entity).Actor.IsExplicitlyNull()) return false;
+
+	// Claim now — the slot leaves the free index and no Foreman re-dispatches it while we travel
+	const FSmartObjectClaimHandle ClaimHandle = SOSub->MarkSlotAsClaimed(
+		SlotHandle, ESmartObjectClaimPriority::Normal, FConstStructView());
+	if (!ClaimHandle.IsValid()) return false;
+
+	Task.SlotHandle = SlotHandle;
+	Task.ClaimHandle = ClaimHandle;
+	Task.TargetActor = TargetActor;
+	Task.Destination = Destination;
+	Task.bMoving = true;
+	Task.bArrived = false;
+	Worker.State = EWorkerState::MovingToTask;
+
+	IdleEntities.Remove(Entity);
+	Claims.Add(Entity, ClaimHandle);
+	return true;
+}
+
+// ─────────────────────────────────────────────────────────
+// Representation — promote near viewpoints / on arrival, demote idle far actors
+// ─────────────────────────────────────────────────────────
+
+void UWytchMassWorkerSubsystem::UpdateRepresentation()
+{
+	WYTCH_SCOPE(STAT_WytchMassRepresentation);
+
+	FMassEntityManager* EntityManager = GetEntityManager();
+	if (!EntityManager || Entities.IsEmpty()) return;
+
+	TArray<FVector, TInlineAllocator<4>> Viewpoints;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController())
+		{
+			FVector Location;
+			FRotator Rotation;
+			PC->GetPlayerViewPoint(Location, Rotation);
+			Viewpoints.Add(Location);
+		}
+	}
+
+	auto NearestViewDistSq = [&Viewpoints](const FVector& Location)
+	{
+		double MinDistSq = TNumericLimits<double>::Max();
+		for (const FVector& Viewpoint : Viewpoints)
+		{
+			MinDistSq = FMath::Min(MinDistSq, FVector::DistSquared(Location, Viewpoint));
+		}
+		return MinDistSq;
+	};
+
+	const double PromoteDistSq = FMath::Square(PromoteDistance);
+	const double DemoteDistSq = FMath::Square(FMath::Max(DemoteDistance, PromoteDistance));
+	int32 Promotions = 0;
+
+	for (int32 Index = Entities.Num() - 1; Index >= 0; --Index)
+	{
+		const FMassEntityHandle Entity = Entities[Index];
+		if (!EntityManager->IsEntityValid(Entity))
+		{
+			// Destroyed outside this subsystem — possibly mid-travel
+			ReleaseClaim(Entity);
+			IdleEntities.Remove(Entity);
+			Entities.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+
+		FWytchWorkerActorFragment& ActorFragment = EntityManager->GetFragmentDataChecked<FWytchWorkerActorFragment>(Entity);
+		FTransformFragment& TransformFragment = EntityManager->GetFragmentDataChecked<FTransformFragment>(Entity);
+
+		if (!ActorFragment.Actor.IsExplicitlyNull())
+		{
+			AAutoBot_Character* Actor = ActorFragment.Actor.Get();
+			if (!Actor)
+			{
+				// Actor destroyed by gameplay — the worker is gone
+				ActorToEntity.Remove(ActorFragment.Actor);
+				EntityManager->DestroyEntity(Entity);
+				Entities.RemoveAtSwap(Index, EAllowShrinking::No);
+				continue;
+			}
+
+			TransformFragment.SetTransform(Actor->GetActorTransform());
+
+			const bool bIdle = Actor->GetCurrentWorkerState() == EWorkerState::Idle && !Actor->HasActiveAssignment();
+			if (bIdle && NearestViewDistSq(Actor->GetActorLocation()) > DemoteDistSq)
+			{
+				Demote(Entity, Actor);
+			}
+			continue;
+		}
+
+		FWytchWorkerTaskFragment& Task = EntityManager->GetFragmentDataChecked<FWytchWorkerTaskFragment>(Entity);
+		if (EntityManager->GetFragmentDataChecked<FWytchWorkerFragment>(Entity).State == EWorkerState::Unavailable)
+		{
+			// Ran out of power — drop the task so the slot goes back to the Foreman
+			IdleEntities.Remove(Entity);
+			if (Task.HasTask())
+			{
+				ReleaseClaim(Entity);
+				Task.SlotHandle = FSmartObjectSlotHandle();
+				Task.ClaimHandle = FSmartObjectClaimHandle::InvalidHandle;
+				Task.TargetActor.Reset();
+				Task.bMoving = false;
+				Task.bArrived = false;
+			}
+			continue;
+		}
+
+		if (Promotions >= MaxPromotionsPerUpdate) continue;
+
+		if (Task.bArrived || NearestViewDistSq(TransformFragment.GetTransform().GetLocation()) <= PromoteDistSq)
+		{
+			if (Promote(Entity))
+			{
+				++Promotions;
+			}
+		}
+	}
+}
+
+AAutoBot_Character* UWytchMassWorkerSubsystem::Promote(FMassEntityHandle Entity)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+	UWorld* World = GetWorld();
+
+	const FWytchWorkerActorFragment& ActorFragment = EntityManager->GetFragmentDataChecked<FWytchWorkerActorFragment>(Entity);
+	const FWytchWorkerFragment& Worker = EntityManager->GetFragmentDataChecked<FWytchWorkerFragment>(Entity);
+	const FTransform SpawnTransform = EntityManager->GetFragmentDataChecked<FTransformFragment>(Entity).GetTransform();
+
+	AAutoBot_Character* Actor = World->SpawnActorDeferred<AAutoBot_Character>(
+		ActorFragment.ActorClass, SpawnTransform, nullptr, nullptr,
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+	if (!Actor) return nullptr;
+
+	if (UAndroidConditionComponent* Condition = Actor->GetCondition())
+	{
+		Condition->PowerLevel = Worker.PowerLevel;
+	}
+	Actor->FinishSpawning(SpawnTransform);
+	if (!Actor->GetController())
+	{
+		Actor->SpawnDefaultController();
+	}
+
+	// Hand the task — and the claim held since dispatch — to the actor
+	FWytchWorkerTaskFragment& Task = EntityManager->GetFragmentDataChecked<FWytchWorkerTaskFragment>(Entity);
+	const FSmartObjectSlotHandle SlotHandle = Task.SlotHandle;
+	const FSmartObjectClaimHandle ClaimHandle = Task.ClaimHandle;
+	AActor* TargetActor = Task.TargetActor.Get();
+	Task.SlotHandle = FSmartObjectSlotHandle();
+	Task.ClaimHandle = FSmartObjectClaimHandle::InvalidHandle;
+	Task.TargetActor.Reset();
+	Task.bMoving = false;
+	Task.bArrived = false;
+
+	EntityManager->GetFragmentDataChecked<FWytchWorkerActorFragment>(Entity).Actor = Actor;
+	ActorToEntity.Add(Actor, Entity);
+	IdleEntities.Remove(Entity);
+	Claims.Remove(Entity);
+
+	if (SlotHandle.IsValid())
+	{
+		IWytchCommandable::Execute_ReceiveSmartObjectAssignment(Actor, ClaimHandle, SlotHandle, TargetActor);
+	}
+
+	// Moves the entity to the promoted archetype — fragment references above are stale after this
+	EntityManager->AddTagToEntity(Entity, FWytchWorkerActorTag::StaticStruct());
+
+	UE_LOG(LogWytchWorker, Verbose, TEXT("MassWorkers: promoted entity to %s%s"),
+		*Actor->GetName(), SlotHandle.IsValid() ? TEXT(" (with task)") : TEXT(""));
+	return Actor;
+}
+
+void UWytchMassWorkerSubsystem::Demote(FMassEntityHandle Entity, AAutoBot_Character* Actor)
+{
+	FMassEntityManager* EntityManager = GetEntityManager();
+
+	ActorToEntity.Remove(Actor);
+	EntityManager->RemoveTagFromEntity(Entity, FWytchWorkerActorTag::StaticStruct());
+
+	EntityManager->GetFragmentDataChecked<FTransformFragment>(Entity).SetTransform(Actor->GetActorTransform());
+
+	FWytchWorkerFragment& Worker = EntityManager->GetFragmentDataChecked<FWytchWorkerFragment>(Entity);
+	Worker.State = IWytchCommandable::Execute_GetWorkerState(Actor);
+	if (const UAndroidConditionComponent* Condition = Actor->GetCondition())
+	{
+		Worker.PowerLevel = Condition->GetPowerLevel();
+		Worker.Capabilities = Condition->GetActiveCapabilityMask();
+	}
+
+	EntityManager->GetFragmentDataChecked<FWytchWorkerActorFragment>(Entity).Actor.Reset();
+	if (Worker.State == EWorkerState::Idle)
+	{
+		IdleEntities.Add(Entity);
+	}
+
+	UE_LOG(LogWytchWorker, Verbose, TEXT("MassWorkers: demoted %s to entity"), *Actor->GetName());
+	Actor->Destroy();
+}
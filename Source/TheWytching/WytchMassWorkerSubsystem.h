@@ -0,0 +1,102 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MassEntityTypes.h"
+#include "SmartObjectRuntime.h"
+#include "WytchCapabilityMask.h"
+#include "WytchMassWorkerSubsystem.generated.h"
+
+class AAutoBot_Character;
+struct FMassEntityManager;
+
+/**
+ * MassEntity representation of AutoBots for crowds beyond what full
+ * characters can carry.
+ *
+ * Workers live as entities (WytchMassWorkerFragments.h) — state, power and
+ * capability mask as fragments, movement and power drain in Mass processors.
+ * The Foreman dispatches idle entities straight from FindIdleWorker /
+ * AssignWorker; an assigned entity holds its slot's claim while it travels.
+ *
+ * A periodic pass promotes an entity to its AAutoBot_Character when it comes
+ * within PromoteDistance of a local viewpoint or arrives at its task (the work
+ * interaction runs on the actor), handing the task and claim to the actor.
+ * Promoted actors that are Idle beyond DemoteDistance fold back into their
+ * entity. Promotions are budgeted per pass to spread spawn cost. The same
+ * pass frees the claim of an entity that died (or ran out of power) before
+ * it promoted.
+ */
+UCLASS(Config = Game)
+class THEWYTCHING_API UWytchMassWorkerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWytchMassWorkerSubsystem* Get(const UWorld* World);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Spawns one entity per transform, defaults taken from ActorClass. Returns the number spawned. */
+	UFUNCTION(BlueprintCallable, Category = "Wytch|Mass")
+	int32 SpawnWorkers(TSubclassOf<AAutoBot_Character> ActorClass, const TArray<FTransform>& Transforms);
+
+	FMassEntityHandle SpawnWorker(TSubclassOf<AAutoBot_Character> ActorClass, const FTransform& Transform);
+
+	/** Nearest unpromoted Idle entity inside Zone (XY) covering Required. Unset if none. Walks the idle index only. */
+	FMassEntityHandle FindIdleWorker(const FBox& Zone, const FWytchCapabilityMask& Required, const FVector& Location) const;
+
+	/** Claims SlotHandle for Entity and starts it moving. False if the entity is not Idle or the claim fails. */
+	bool AssignWorker(FMassEntityHandle Entity, FSmartObjectSlotHandle SlotHandle, AActor* TargetActor,
+		const FVector& Destination);
+
+	int32 Num() const { return Entities.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category = "Wytch|Mass")
+	int32 GetNumPromoted() const { return ActorToEntity.Num(); }
+
+	/** Seconds between promotion passes. */
+	UPROPERTY(Config)
+	float UpdateInterval = 0.5f;
+
+	/** Entities this close to a local viewpoint promote to actors. */
+	UPROPERTY(Config)
+	float PromoteDistance = 4000.f;
+
+	/** Idle actors beyond this from every viewpoint demote. Keep above PromoteDistance. */
+	UPROPERTY(Config)
+	float DemoteDistance = 6000.f;
+
+	/** Actor spawns per pass. */
+	UPROPERTY(Config)
+	int32 MaxPromotionsPerUpdate = 8;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void UpdateRepresentation();
+
+	AAutoBot_Character* Promote(FMassEntityHandle Entity);
+	void Demote(FMassEntityHandle Entity, AAutoBot_Character* Actor);
+
+	/** Frees the slot claimed for Entity at dispatch, if it still holds one. */
+	void ReleaseClaim(FMassEntityHandle Entity);
+
+	FMassEntityManager* GetEntityManager() const;
+
+	FMassArchetypeHandle WorkerArchetype;
+
+	TArray<FMassEntityHandle> Entities;
+	TMap<TWeakObjectPtr<AAutoBot_Character>, FMassEntityHandle> ActorToEntity;
+
+	/** Unpromoted entities left Idle with no task. The power processor can turn one Unavailable — re-checked on use. */
+	TSet<FMassEntityHandle> IdleEntities;
+
+	/** Claims held by travelling entities, kept here so they outlive the entity's fragments. */
+	TMap<FMassEntityHandle, FSmartObjectClaimHandle> Claims;
+
+	FTimerHandle UpdateTimerHandle;
+};
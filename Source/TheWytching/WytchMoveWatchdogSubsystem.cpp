@@ -0,0 +1,166 @@
+#include "WytchMoveWatchdogSubsystem.h"
+
+#include "WytchingStats.h"
+#include "AndroidTypes.h"
+#include "AIController.h"
+#include "NavigationData.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+namespace
+{
+	/**
+	 * Path length left while the mover's AI controller follows a path, else
+	 * straight-line distance. A detour around a wall lengthens the straight
+	 * line while the path still shrinks, so only the latter reads as progress.
+	 */
+	float GetRemainingDistance(const AActor& Mover, const FVector& Destination)
+	{
+		const APawn* Pawn = Cast<APawn>(&Mover);
+		const AAIController* AIC = Pawn ? Cast<AAIController>(Pawn->GetController()) : nullptr;
+		const UPathFollowingComponent* PathFollowing = AIC ? AIC->GetPathFollowingComponent() : nullptr;
+		if (PathFollowing && PathFollowing->GetStatus() != EPathFollowingStatus::Idle)
+		{
+			const FNavPathSharedPtr Path = PathFollowing->GetPath();
+			if (Path.IsValid() && Path->IsValid())
+			{
+				return static_cast<float>(Path->GetLengthFromPosition(Mover.GetActorLocation(), PathFollowing->GetNextPathIndex()));
+			}
+		}
+		return static_cast<float>(FVector::Dist(Mover.GetActorLocation(), Destination));
+	}
+}
+
+UWytchMoveWatchdogSubsystem* UWytchMoveWatchdogSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UWytchMoveWatchdogSubsystem>() : nullptr;
+}
+
+bool UWytchMoveWatchdogSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWytchMoveWatchdogSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(CheckTimerHandle);
+	}
+
+	Moves.Reset();
+	IndexByMover.Reset();
+
+	Super::Deinitialize();
+}
+
+void UWytchMoveWatchdogSubsystem::Watch(AActor* Mover, const FVector& Destination, float AcceptanceRadius,
+	FOnWytchMoveWatchdogEvent Callback)
+{
+	if (!Mover) return;
+
+	Unwatch(Mover);
+
+	FWatchedMove& Move = Moves.AddDefaulted_GetRef();
+	Move.Mover = Mover;
+	Move.Destination = Destination;
+	Move.AcceptanceRadiusSq = FMath::Square(AcceptanceRadius);
+	// The path is requested after Watch — the first check sets the baseline
+	Move.BestDistance = TNumericLimits<float>::Max();
+	Move.LastProgressTime = GetWorld()->GetTimeSeconds();
+	Move.Callback = MoveTemp(Callback);
+	IndexByMover.Add(Mover, Moves.Num() - 1);
+
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	if (!TimerManager.IsTimerActive(CheckTimerHandle))
+	{
+		TimerManager.SetTimer(CheckTimerHandle, this, &UWytchMoveWatchdogSubsystem::CheckMoves,
+			CheckInterval, /*bLoop=*/true);
+	}
+}
+
+void UWytchMoveWatchdogSubsystem::Unwatch(AActor* Mover)
+{
+	int32 Index = INDEX_NONE;
+	if (IndexByMover.RemoveAndCopyValue(Mover, Index))
+	{
+		RemoveAt(Index);
+	}
+}
+
+void UWytchMoveWatchdogSubsystem::RemoveAt(int32 Index)
+{
+	// Swap-remove and fix up the moved entry's index
+	Moves.RemoveAtSwap(Index, EAllowShrinking::No);
+	if (Moves.IsValidIndex(Index))
+	{
+		IndexByMover.FindChecked(Moves[Index].Mover) = Index;
+	}
+
+	if (Moves.IsEmpty())
+	{
+		if (UWorld* World = GetWorld())
+		{
+			World->GetTimerManager().ClearTimer(CheckTimerHandle);
+		}
+	}
+}
+
+void UWytchMoveWatchdogSubsystem::CheckMoves()
+{
+	WYTCH_SCOPE(STAT_WytchMoveWatchdog);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// Collect first — callbacks start new moves or unwatch
+	TArray<TPair<FOnWytchMoveWatchdogEvent, EWytchMoveWatchdogEvent>> Fired;
+
+	for (int32 Index = Moves.Num() - 1; Index >= 0; --Index)
+	{
+		FWatchedMove& Move = Moves[Index];
+		const AActor* Mover = Move.Mover.Get();
+		if (!Mover)
+		{
+			IndexByMover.Remove(Move.Mover);
+			RemoveAt(Index);
+			continue;
+		}
+
+		const FVector Location = Mover->GetActorLocation();
+		EWytchMoveWatchdogEvent Event;
+
+		if (FVector::DistSquared(Location, Move.Destination) <= Move.AcceptanceRadiusSq)
+		{
+			Event = EWytchMoveWatchdogEvent::Arrived;
+		}
+		else
+		{
+			const float Distance = GetRemainingDistance(*Mover, Move.Destination);
+			if (Distance < Move.BestDistance - MinProgress)
+			{
+				Move.BestDistance = Distance;
+				Move.LastProgressTime = Now;
+				continue;
+			}
+			if (Now - Move.LastProgressTime < StuckTimeout)
+			{
+				continue;
+			}
+
+			UE_LOG(LogWytchWorker, Warning, TEXT("MoveWatchdog: %s stuck %.0f units from goal for %.1fs"),
+				*Mover->GetName(), Distance, Now - Move.LastProgressTime);
+			Event = EWytchMoveWatchdogEvent::Stuck;
+		}
+
+		Fired.Emplace(MoveTemp(Move.Callback), Event);
+		IndexByMover.Remove(Move.Mover);
+		RemoveAt(Index);
+	}
+
+	for (TPair<FOnWytchMoveWatchdogEvent, EWytchMoveWatchdogEvent>& Pair : Fired)
+	{
+		Pair.Key.ExecuteIfBound(Pair.Value);
+	}
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WytchMoveWatchdogSubsystem.generated.h"
+
+enum class EWytchMoveWatchdogEvent : uint8
+{
+	/**
+	 * Mover is inside its acceptance radius but no move-completed callback arrived.
+	 * Its path request may still be active — abort it before acting on the arrival.
+	 */
+	Arrived,
+	/** Mover's remaining path (or distance, with no path) has not shrunk for StuckTimeout seconds. */
+	Stuck
+};
+
+DECLARE_DELEGATE_OneParam(FOnWytchMoveWatchdogEvent, EWytchMoveWatchdogEvent /*Event*/);
+
+/**
+ * Fallback for path-following arrival detection.
+ *
+ * Workers detect arrival from their AI controller's move-completed callback;
+ * this subsystem only catches the cases that never report — no controller,
+ * a move that ended short of the goal, or a worker wedged against geometry.
+ * One timer checks every watched move each CheckInterval, so the cost is a
+ * distance test (plus a remaining-path walk while the mover's AI controller
+ * follows a path) per mover per interval rather than a timer per worker.
+ * A move fires at most one event and is unwatched before its callback runs.
+ */
+UCLASS(Config = Game)
+class THEWYTCHING_API UWytchMoveWatchdogSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWytchMoveWatchdogSubsystem* Get(const UWorld* World);
+
+	virtual void Deinitialize() override;
+
+	/** Watches Mover until it reaches Destination, gets stuck, or is unwatched. Replaces any previous watch. */
+	void Watch(AActor* Mover, const FVector& Destination, float AcceptanceRadius, FOnWytchMoveWatchdogEvent Callback);
+
+	void Unwatch(AActor* Mover);
+
+	int32 Num() const { return Moves.Num(); }
+
+	/** Seconds between checks. */
+	UPROPERTY(Config)
+	float CheckInterval = 1.f;
+
+	/** Seconds without MinProgress off the remaining path length before a move counts as stuck. */
+	UPROPERTY(Config)
+	float StuckTimeout = 5.f;
+
+	/** World units a mover must close to reset the stuck clock. */
+	UPROPERTY(Config)
+	float MinProgress = 50.f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FWatchedMove
+	{
+		TWeakObjectPtr<AActor> Mover;
+		FVector Destination = FVector::ZeroVector;
+		float AcceptanceRadiusSq = 0.f;
+		float BestDistance = 0.f;
+		double LastProgressTime = 0.0;
+		FOnWytchMoveWatchdogEvent Callback;
+	};
+
+	void CheckMoves();
+	void RemoveAt(int32 Index);
+
+	TArray<FWatchedMove> Moves;
+	TMap<TWeakObjectPtr<AActor>, int32> IndexByMover;
+
+	FTimerHandle CheckTimerHandle;
+};
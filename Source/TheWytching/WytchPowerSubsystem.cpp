@@ -0,0 +1,498 @@
+#include "WytchPowerSubsystem.h"
+
+#include "WytchingStats.h"
+#include "AndroidConditionComponent.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/Package.h"
+
+UWytchPowerSubsystem* UWytchPowerSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UWytchPowerSubsystem>() : nullptr;
+}
+
+bool UWytchPowerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWytchPowerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (!bAnalyticDrain)
+	{
+		InWorld.GetTimerManager().SetTimer(DrainTimerHandle, this,
+			&UWytchPowerSubsystem::Drain, DrainInterval, /*bLoop=*/true);
+	}
+}
+
+void UWytchPowerSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(DrainTimerHandle);
+		World->GetTimerManager().ClearTimer(CrossingTimerHandle);
+	}
+
+	Conditions.Reset();
+	Levels.Reset();
+	DrainRates.Reset();
+	States.Reset();
+	StartTimes.Reset();
+	Serials.Reset();
+	IndexByCondition.Reset();
+	Crossings.Reset();
+
+	Super::Deinitialize();
+}
+
+// ─────────────────────────────────────────────────────────
+// Registration
+// ─────────────────────────────────────────────────────────
+
+void UWytchPowerSubsystem::RegisterCondition(UAndroidConditionComponent* Condition)
+{
+	if (!Condition || IndexByCondition.Contains(Condition)) return;
+
+	const int32 Index = Conditions.Num();
+	IndexByCondition.Add(Condition, Index);
+	Conditions.Add(Condition);
+	Levels.Add(Condition->PowerLevel);
+	DrainRates.Add(Condition->PowerDrainRate);
+	States.Add(UAndroidConditionComponent::GetPowerStateForLevel(Condition->PowerLevel));
+	StartTimes.Add(GetWorld()->GetTimeSeconds());
+	Serials.Add(0);
+
+	ScheduleNextCrossing(Index);
+}
+
+void UWytchPowerSubsystem::UnregisterCondition(UAndroidConditionComponent* Condition)
+{
+	int32 Index = INDEX_NONE;
+	if (IndexByCondition.RemoveAndCopyValue(Condition, Index))
+	{
+		Condition->PowerLevel = LevelAt(Index, GetWorld()->GetTimeSeconds());
+		RemoveAt(Index);
+	}
+}
+
+bool UWytchPowerSubsystem::TryGetPowerLevel(const UAndroidConditionComponent* Condition, float& OutLevel) const
+{
+	const int32* Index = IndexByCondition.Find(Condition);
+	if (!Index) return false;
+
+	OutLevel = LevelAt(*Index, GetWorld()->GetTimeSeconds());
+	return true;
+}
+
+void UWytchPowerSubsystem::SetPowerLevel(const UAndroidConditionComponent* Condition, float Level)
+{
+	if (const int32* Index = IndexByCondition.Find(Condition))
+	{
+		Levels[*Index] = Level;
+		StartTimes[*Index] = GetWorld()->GetTimeSeconds();
+		States[*Index] = UAndroidConditionComponent::GetPowerStateForLevel(Level);
+		ScheduleNextCrossing(*Index);
+	}
+}
+
+void UWytchPowerSubsystem::SetDrainRate(const UAndroidConditionComponent* Condition, float Rate)
+{
+	if (const int32* Index = IndexByCondition.Find(Condition))
+	{
+		if (DrainRates[*Index] == Rate) return;
+
+		Rebase(*Index, GetWorld()->GetTimeSeconds());
+		DrainRates[*Index] = Rate;
+		ScheduleNextCrossing(*Index);
+	}
+}
+
+float UWytchPowerSubsystem::LevelAt(int32 Index, double Now) const
+{
+	if (!bAnalyticDrain)
+	{
+		return Levels[Index];
+	}
+	return FMath::Max(Levels[Index] - DrainRates[Index] * static_cast<float>(Now - StartTimes[Index]), 0.f);
+}
+
+void UWytchPowerSubsystem::Rebase(int32 Index, double Now)
+{
+	Levels[Index] = LevelAt(Index, Now);
+	StartTimes[Index] = Now;
+}
+
+void UWytchPowerSubsystem::RemoveAt(int32 Index)
+{
+	Conditions.RemoveAtSwap(Index, EAllowShrinking::No);
+	Levels.RemoveAtSwap(Index, EAllowShrinking::No);
+	DrainRates.RemoveAtSwap(Index, EAllowShrinking::No);
+	States.RemoveAtSwap(Index, EAllowShrinking::No);
+	StartTimes.RemoveAtSwap(Index, EAllowShrinking::No);
+	Serials.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	if (Conditions.IsValidIndex(Index))
+	{
+		IndexByCondition.FindChecked(TWeakObjectPtr<const UAndroidConditionComponent>(Conditions[Index])) = Index;
+	}
+}
+
+void UWytchPowerSubsystem::RemoveStaleConditions()
+{
+	// Drop androids destroyed without EndPlay
+	for (int32 Index = Conditions.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Conditions[Index].IsValid())
+		{
+			IndexByCondition.Remove(TWeakObjectPtr<const UAndroidConditionComponent>(Conditions[Index]));
+			RemoveAt(Index);
+		}
+	}
+}
+
+// ─────────────────────────────────────────────────────────
+// Batched drain — one pass over every android
+// ─────────────────────────────────────────────────────────
+
+void UWytchPowerSubsystem::DrainPass(TArrayView<float> Levels, TConstArrayView<float> Rates,
+	TArrayView<EAndroidPowerState> States, float DeltaTime, TArray<int32>& OutCrossed)
+{
+	check(Levels.Num() == Rates.Num() && Levels.Num() == States.Num());
+
+	const int32 Count = Levels.Num();
+	const int32 VectorCount = Count & ~3;
+	float* LevelData = Levels.GetData();
+	const float* RateData = Rates.GetData();
+
+	// Level = max(Level - Rate * Dt, 0), four androids per instruction
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	const VectorRegister4Float Dt = VectorSetFloat1(DeltaTime);
+	for (int32 Index = 0; Index < VectorCount; Index += 4)
+	{
+		const VectorRegister4Float Level = VectorLoad(LevelData + Index);
+		const VectorRegister4Float Rate = VectorLoad(RateData + Index);
+		VectorStore(VectorMax(VectorNegateMultiplyAdd(Rate, Dt, Level), Zero), LevelData + Index);
+	}
+	for (int32 Index = VectorCount; Index < Count; ++Index)
+	{
+		LevelData[Index] = FMath::Max(LevelData[Index] - RateData[Index] * DeltaTime, 0.f);
+	}
+
+	// Re-bracket — only crossings leave this loop
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const EAndroidPowerState NewState = UAndroidConditionComponent::GetPowerStateForLevel(LevelData[Index]);
+		if (NewState != States[Index])
+		{
+			States[Index] = NewState;
+			OutCrossed.Add(Index);
+		}
+	}
+}
+
+void UWytchPowerSubsystem::Drain()
+{
+	WYTCH_SCOPE(STAT_WytchPowerDrain);
+
+	RemoveStaleConditions();
+	if (Conditions.IsEmpty()) return;
+
+	TArray<int32> CrossedIndices;
+	DrainPass(Levels, DrainRates, States, DrainInterval, CrossedIndices);
+
+	// Listeners may register, unregister or set power, so broadcast after the pass
+	struct FCrossing
+	{
+		TWeakObjectPtr<UAndroidConditionComponent> Condition;
+		float Level;
+	};
+	TArray<FCrossing, TInlineAllocator<16>> Crossed;
+	for (const int32 Index : CrossedIndices)
+	{
+		Crossed.Add({ Conditions[Index], Levels[Index] });
+	}
+
+	for (const FCrossing& Crossing : Crossed)
+	{
+		if (UAndroidConditionComponent* Condition = Crossing.Condition.Get())
+		{
+			Condition->ApplyPowerLevel(Crossing.Level);
+		}
+	}
+}
+
+// ─────────────────────────────────────────────────────────
+// Analytic drain — one event per threshold crossing
+// ─────────────────────────────────────────────────────────
+
+void UWytchPowerSubsystem::ScheduleNextCrossing(int32 Index)
+{
+	if (!bAnalyticDrain) return;
+
+	// Any crossing already queued for this android is superseded
+	Serials[Index] = NextSerial++;
+
+	const float Threshold = UAndroidConditionComponent::GetNextPowerThreshold(States[Index]);
+	const float Rate = DrainRates[Index];
+	if (Threshold < 0.f || Rate <= 0.f) return;
+
+	// Frequent rate changes leave superseded entries behind — drop them before they outnumber live ones
+	if (Crossings.Num() > 2 * Conditions.Num() + 16)
+	{
+		Crossings.RemoveAllSwap([this](const FPowerCrossing& Queued)
+		{
+			const int32* QueuedIndex = IndexByCondition.Find(Queued.Condition);
+			return !QueuedIndex || Serials[*QueuedIndex] != Queued.Serial;
+		});
+		Crossings.Heapify();
+	}
+
+	FPowerCrossing Crossing;
+	Crossing.Time = StartTimes[Index] + FMath::Max(Levels[Index] - Threshold, 0.f) / Rate;
+	Crossing.Condition = Conditions[Index];
+	Crossing.Serial = Serials[Index];
+	Crossing.Threshold = Threshold;
+	Crossings.HeapPush(MoveTemp(Crossing));
+
+	ArmCrossingTimer();
+}
+
+void UWytchPowerSubsystem::ArmCrossingTimer()
+{
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	if (Crossings.IsEmpty())
+	{
+		TimerManager.ClearTimer(CrossingTimerHandle);
+		return;
+	}
+
+	// Only re-arm when the earliest crossing moved earlier than the pending event
+	const double Now = GetWorld()->GetTimeSeconds();
+	const float Delay = FMath::Max(static_cast<float>(Crossings.HeapTop().Time - Now), KINDA_SMALL_NUMBER);
+	if (TimerManager.IsTimerActive(CrossingTimerHandle) && TimerManager.GetTimerRemaining(CrossingTimerHandle) <= Delay)
+	{
+		return;
+	}
+	TimerManager.SetTimer(CrossingTimerHandle, this, &UWytchPowerSubsystem::HandleCrossings, Delay, /*bLoop=*/false);
+}
+
+void UWytchPowerSubsystem::HandleCrossings()
+{
+	WYTCH_SCOPE(STAT_WytchPowerDrain);
+
+	// This event is spent — re-armed for the next crossing below
+	GetWorld()->GetTimerManager().ClearTimer(CrossingTimerHandle);
+
+	RemoveStaleConditions();
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	struct FCrossing
+	{
+		TWeakObjectPtr<UAndroidConditionComponent> Condition;
+		float Level;
+	};
+	TArray<FCrossing, TInlineAllocator<16>> Crossed;
+
+	while (!Crossings.IsEmpty() && Crossings.HeapTop().Time <= Now + KINDA_SMALL_NUMBER)
+	{
+		FPowerCrossing Crossing;
+		Crossings.HeapPop(Crossing, EAllowShrinking::No);
+
+		const int32* Index = IndexByCondition.Find(Crossing.Condition);
+		if (!Index || Serials[*Index] != Crossing.Serial) continue;
+
+		// Anchor exactly on the threshold — the bracket change never depends on float drift
+		Levels[*Index] = Crossing.Threshold;
+		StartTimes[*Index] = Crossing.Time;
+		States[*Index] = UAndroidConditionComponent::GetPowerStateForLevel(Crossing.Threshold);
+		Crossed.Add({ Conditions[*Index], Crossing.Threshold });
+
+		ScheduleNextCrossing(*Index);
+	}
+
+	ArmCrossingTimer();
+
+	// Listeners may register, unregister or set power, so broadcast after the pass
+	for (const FCrossing& Crossing : Crossed)
+	{
+		if (UAndroidConditionComponent* Condition = Crossing.Condition.Get())
+		{
+			Condition->ApplyPowerLevel(Crossing.Level);
+		}
+	}
+}
+
+// ─────────────────────────────────────────────────────────
+// Benchmark — wytch.power.bench [Iterations]
+// ─────────────────────────────────────────────────────────
+
+namespace WytchPowerBench
+{
+	static const int32 Counts[] = { 100, 1000, 10000 };
+
+	/**
+	 * One bench run. FTimerManager ticks at most once per frame, so the timer path
+	 * ticks a private manager once per real frame (one pass each); the batched path
+	 * runs its passes back to back when a case's timer passes are done.
+	 */
+	struct FRun
+	{
+		int32 Iterations = 0;
+		float Interval = 0.f;
+		ELogVerbosity::Type SavedVerbosity = ELogVerbosity::Log;
+
+		int32 CaseIndex = 0;
+		TArray<UAndroidConditionComponent*> Components;
+		TArray<float> StartLevels;
+		TUniquePtr<FTimerManager> TimerManager;
+		int32 Pass = 0;
+		double TimerSeconds = 0.0;
+	};
+
+	static bool bRunning = false;
+
+	static void ResetLevels(FRun& Run)
+	{
+		for (int32 Index = 0; Index < Run.Components.Num(); ++Index)
+		{
+			Run.Components[Index]->ApplyPowerLevel(Run.StartLevels[Index]);
+		}
+	}
+
+	static void BeginCase(FRun& Run)
+	{
+		const int32 Count = Counts[Run.CaseIndex];
+		FRandomStream Random(Count);
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			// Rooted — the case spans frames and GC may run between them
+			UAndroidConditionComponent* Component = NewObject<UAndroidConditionComponent>(GetTransientPackage());
+			Component->AddToRoot();
+			Component->PowerDrainRate = Random.FRandRange(0.0005f, 0.005f);
+			Run.Components.Add(Component);
+			Run.StartLevels.Add(Random.FRandRange(0.2f, 1.f));
+		}
+		ResetLevels(Run);
+
+		// Per-component timers: a looping SetTimer per android, so each pass pays the real
+		// heap pop / dispatch / re-queue plus one scattered UObject write per android
+		const float Interval = Run.Interval;
+		Run.TimerManager = MakeUnique<FTimerManager>();
+		for (UAndroidConditionComponent* Component : Run.Components)
+		{
+			FTimerHandle Handle;
+			Run.TimerManager->SetTimer(Handle, FTimerDelegate::CreateWeakLambda(Component, [Component, Interval]()
+			{
+				Component->ApplyPowerLevel(FMath::Max(Component->PowerLevel - Component->PowerDrainRate * Interval, 0.f));
+			}), Interval, /*bLoop=*/true);
+		}
+		Run.Pass = 0;
+		Run.TimerSeconds = 0.0;
+	}
+
+	static void FinishCase(FRun& Run)
+	{
+		Run.TimerManager.Reset();
+
+		// Batched: SoA drain pass, write-back only for crossings
+		ResetLevels(Run);
+		const int32 Count = Run.Components.Num();
+		TArray<float> Levels = Run.StartLevels;
+		TArray<float> Rates;
+		TArray<EAndroidPowerState> States;
+		for (const UAndroidConditionComponent* Component : Run.Components)
+		{
+			Rates.Add(Component->PowerDrainRate);
+			States.Add(Component->PowerState);
+		}
+		TArray<int32> Crossed;
+		int32 NumCrossed = 0;
+
+		const double BatchStart = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Run.Iterations; ++Iteration)
+		{
+			Crossed.Reset();
+			UWytchPowerSubsystem::DrainPass(Levels, Rates, States, Run.Interval, Crossed);
+			for (const int32 Index : Crossed)
+			{
+				Run.Components[Index]->ApplyPowerLevel(Levels[Index]);
+			}
+			NumCrossed += Crossed.Num();
+		}
+		const double BatchSeconds = FPlatformTime::Seconds() - BatchStart;
+
+		UE_LOG(LogWytchAndroid, Display,
+			TEXT("wytch.power.bench: %5d androids x %d passes — timers %.3f ms/pass, batched %.3f ms/pass (%.1fx, %d crossings)"),
+			Count, Run.Iterations,
+			Run.TimerSeconds * 1000.0 / Run.Iterations,
+			BatchSeconds * 1000.0 / Run.Iterations,
+			BatchSeconds > 0.0 ? Run.TimerSeconds / BatchSeconds : 0.0,
+			NumCrossed);
+
+		for (UAndroidConditionComponent* Component : Run.Components)
+		{
+			Component->RemoveFromRoot();
+			Component->MarkAsGarbage();
+		}
+		Run.Components.Reset();
+		Run.StartLevels.Reset();
+	}
+
+	/** Core ticker callback — one timer pass per frame. False once every case has been logged. */
+	static bool TickRun(FRun& Run)
+	{
+		const double PassStart = FPlatformTime::Seconds();
+		Run.TimerManager->Tick(Run.Interval);
+		Run.TimerSeconds += FPlatformTime::Seconds() - PassStart;
+
+		if (++Run.Pass < Run.Iterations)
+		{
+			return true;
+		}
+
+		FinishCase(Run);
+		if (++Run.CaseIndex < UE_ARRAY_COUNT(Counts))
+		{
+			BeginCase(Run);
+			return true;
+		}
+
+		LogWytchAndroid.SetVerbosity(Run.SavedVerbosity);
+		bRunning = false;
+		return false;
+	}
+
+	static void Run(const TArray<FString>& Args)
+	{
+		if (bRunning)
+		{
+			UE_LOG(LogWytchAndroid, Warning, TEXT("wytch.power.bench: already running"));
+			return;
+		}
+		bRunning = true;
+
+		TSharedRef<FRun> BenchRun = MakeShared<FRun>();
+		BenchRun->Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 50;
+		BenchRun->Interval = GetDefault<UWytchPowerSubsystem>()->DrainInterval;
+
+		// Crossings would log through LogWytchAndroid in both paths — keep the log out of the timing
+		BenchRun->SavedVerbosity = LogWytchAndroid.GetVerbosity();
+		LogWytchAndroid.SetVerbosity(ELogVerbosity::Warning);
+
+		BeginCase(*BenchRun);
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([BenchRun](float)
+		{
+			return TickRun(*BenchRun);
+		}));
+	}
+
+	static FAutoConsoleCommand Command(
+		TEXT("wytch.power.bench"),
+		TEXT("Times per-component looping SetTimer drains (one pass per frame) against the batched SoA drain pass at 100/1k/10k androids. Optional arg: passes (default 50)."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+}
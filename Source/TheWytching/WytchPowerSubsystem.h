@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AndroidTypes.h"
+#include "WytchPowerSubsystem.generated.h"
+
+class UAndroidConditionComponent;
+
+/**
+ * Central power drain for every android condition.
+ *
+ * Registered conditions hand their level, drain rate and power bracket to
+ * parallel arrays here. In batched mode one timer drains every android in a
+ * single SIMD pass per DrainInterval, then a threshold pass compares brackets and only the
+ * androids that crossed Low/Critical/Dead are written back and broadcast
+ * OnPowerStateChanged. Nothing else touches component memory between
+ * crossings — UAndroidConditionComponent::GetPowerLevel reads from here.
+ *
+ * With bAnalyticDrain (default) there is no periodic pass at all. Drain is
+ * linear, so each android stores only the level and time its current rate
+ * took effect; the live level is derived on read and the time of its next
+ * threshold crossing is pushed to a min-heap. One one-shot timer is armed for
+ * the earliest crossing. A schedule is recomputed only when that android's
+ * level or drain rate is set — e.g. a StateTree task changing activity.
+ *
+ * `wytch.power.bench` compares the batched pass against per-component drain timers.
+ */
+UCLASS(Config = Game)
+class THEWYTCHING_API UWytchPowerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWytchPowerSubsystem* Get(const UWorld* World);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Takes over Condition's drain, starting from its PowerLevel / PowerDrainRate fields. */
+	void RegisterCondition(UAndroidConditionComponent* Condition);
+
+	/** Writes the live level back to Condition's PowerLevel field and stops draining it. */
+	void UnregisterCondition(UAndroidConditionComponent* Condition);
+
+	/** Live level. False if Condition is not registered. */
+	bool TryGetPowerLevel(const UAndroidConditionComponent* Condition, float& OutLevel) const;
+
+	/** Overrides the live level. The component handles its own state broadcast. */
+	void SetPowerLevel(const UAndroidConditionComponent* Condition, float Level);
+
+	void SetDrainRate(const UAndroidConditionComponent* Condition, float Rate);
+
+	int32 Num() const { return Conditions.Num(); }
+
+	/**
+	 * Drains Levels by Rates * DeltaTime (floored at 0), then re-brackets each
+	 * entry and appends the index of every one whose state changed to OutCrossed.
+	 */
+	static void DrainPass(TArrayView<float> Levels, TConstArrayView<float> Rates,
+		TArrayView<EAndroidPowerState> States, float DeltaTime, TArray<int32>& OutCrossed);
+
+	/** Seconds between drain passes. Batched mode only. */
+	UPROPERTY(Config)
+	float DrainInterval = 1.5f;
+
+	/** Derive levels from (start level, start time, rate) and schedule threshold crossings instead of draining periodically. */
+	UPROPERTY(Config)
+	bool bAnalyticDrain = true;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void Drain();
+	void RemoveAt(int32 Index);
+	void RemoveStaleConditions();
+
+	/** Level of entry Index now — Levels[Index] itself in batched mode. */
+	float LevelAt(int32 Index, double Now) const;
+
+	/** Re-anchors entry Index at Now so a new level or rate takes effect from here. */
+	void Rebase(int32 Index, double Now);
+
+	// ── Analytic mode ──
+
+	/** Pushes entry Index's next threshold crossing (if it drains toward one) and re-arms the event timer. */
+	void ScheduleNextCrossing(int32 Index);
+	void ArmCrossingTimer();
+	void HandleCrossings();
+
+	struct FPowerCrossing
+	{
+		double Time = 0.0;
+		TWeakObjectPtr<const UAndroidConditionComponent> Condition;
+		/** Matches Serials[] only while the schedule that pushed this is current. */
+		uint32 Serial = 0;
+		float Threshold = 0.f;
+
+		bool operator<(const FPowerCrossing& Other) const { return Time < Other.Time; }
+	};
+
+	// SoA — index i across every array is one android
+	TArray<TWeakObjectPtr<UAndroidConditionComponent>> Conditions;
+
+	/** Batched: live level. Analytic: level at StartTimes[i]. */
+	TArray<float> Levels;
+	TArray<float> DrainRates;
+	TArray<EAndroidPowerState> States;
+	TArray<double> StartTimes;
+	TArray<uint32> Serials;
+
+	TMap<TWeakObjectPtr<const UAndroidConditionComponent>, int32> IndexByCondition;
+
+	/** Min-heap on Time. Superseded entries are skipped when they surface. */
+	TArray<FPowerCrossing> Crossings;
+	uint32 NextSerial = 1;
+
+	FTimerHandle DrainTimerHandle;
+	FTimerHandle CrossingTimerHandle;
+};
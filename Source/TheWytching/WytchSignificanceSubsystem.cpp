@@ -0,0 +1,197 @@
+#include "WytchSignificanceSubsystem.h"
+
+#include "WytchingStats.h"
+#include "AutoBot_Character.h"
+#include "AndroidTypes.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+UWytchSignificanceSubsystem* UWytchSignificanceSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UWytchSignificanceSubsystem>() : nullptr;
+}
+
+bool UWytchSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UWytchSignificanceSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	InWorld.GetTimerManager().SetTimer(UpdateTimerHandle, this,
+		&UWytchSignificanceSubsystem::UpdateSignificance, UpdateInterval, /*bLoop=*/true);
+}
+
+void UWytchSignificanceSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(UpdateTimerHandle);
+	}
+
+	Workers.Reset();
+	Tiers.Reset();
+	IndexByWorker.Reset();
+
+	Super::Deinitialize();
+}
+
+// ─────────────────────────────────────────────────────────
+// Registration
+// ─────────────────────────────────────────────────────────
+
+void UWytchSignificanceSubsystem::RegisterWorker(AAutoBot_Character* Worker)
+{
+	if (!Worker || IndexByWorker.Contains(Worker)) return;
+
+	IndexByWorker.Add(Worker, Workers.Num());
+	Workers.Add(Worker);
+	Tiers.Add(EWytchSignificanceTier::High);
+
+	Worker->ApplySignificanceTier(EWytchSignificanceTier::High, HighTier);
+}
+
+void UWytchSignificanceSubsystem::UnregisterWorker(AAutoBot_Character* Worker)
+{
+	int32 Index = INDEX_NONE;
+	if (!IndexByWorker.RemoveAndCopyValue(Worker, Index)) return;
+
+	Workers.RemoveAtSwap(Index, EAllowShrinking::No);
+	Tiers.RemoveAtSwap(Index, EAllowShrinking::No);
+	if (Workers.IsValidIndex(Index))
+	{
+		IndexByWorker.FindChecked(Workers[Index]) = Index;
+	}
+}
+
+const FWytchSignificanceTierSettings& UWytchSignificanceSubsystem::GetTierSettings(EWytchSignificanceTier Tier) const
+{
+	switch (Tier)
+	{
+	case EWytchSignificanceTier::High:   return HighTier;
+	case EWytchSignificanceTier::Medium: return MediumTier;
+	case EWytchSignificanceTier::Low:    return LowTier;
+	default:                             return DormantTier;
+	}
+}
+
+int32 UWytchSignificanceSubsystem::GetNumInTier(EWytchSignificanceTier Tier) const
+{
+	int32 Count = 0;
+	for (const EWytchSignificanceTier WorkerTier : Tiers)
+	{
+		Count += WorkerTier == Tier ? 1 : 0;
+	}
+	return Count;
+}
+
+// ─────────────────────────────────────────────────────────
+// Tier selection
+// ─────────────────────────────────────────────────────────
+
+int32 UWytchSignificanceSubsystem::GetDistanceTier(float Distance) const
+{
+	constexpr int32 DormantIndex = (int32)EWytchSignificanceTier::Dormant;
+	for (int32 Tier = 0; Tier < DormantIndex; ++Tier)
+	{
+		const float MaxDistance = GetTierSettings((EWytchSignificanceTier)Tier).MaxDistance;
+		if (MaxDistance <= 0.f || Distance <= MaxDistance)
+		{
+			return Tier;
+		}
+	}
+	return DormantIndex;
+}
+
+EWytchSignificanceTier UWytchSignificanceSubsystem::ComputeTier(float Distance, bool bVisible,
+	EWytchSignificanceTier Current) const
+{
+	constexpr int32 DormantIndex = (int32)EWytchSignificanceTier::Dormant;
+	const int32 Penalty = bVisible ? 0 : 1;
+	const int32 CurrentIndex = (int32)Current;
+
+	const int32 Target = FMath::Min(GetDistanceTier(Distance) + Penalty, DormantIndex);
+	if (Target < CurrentIndex)
+	{
+		return (EWytchSignificanceTier)Target;
+	}
+
+	// Demote only once clear of the boundary by the hysteresis band, and one tier at a time
+	const float StickyDistance = Distance / (1.f + FMath::Max(HysteresisFraction, 0.f));
+	const int32 StickyTarget = FMath::Min(GetDistanceTier(StickyDistance) + Penalty, DormantIndex);
+	if (StickyTarget > CurrentIndex)
+	{
+		return (EWytchSignificanceTier)(CurrentIndex + 1);
+	}
+	return Current;
+}
+
+// ─────────────────────────────────────────────────────────
+// Update pass
+// ─────────────────────────────────────────────────────────
+
+void UWytchSignificanceSubsystem::UpdateSignificance()
+{
+	WYTCH_SCOPE(STAT_WytchSignificance);
+
+	if (Workers.IsEmpty()) return;
+
+	UWorld* World = GetWorld();
+
+	TArray<FVector, TInlineAllocator<4>> Viewpoints;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController())
+		{
+			FVector Location;
+			FRotator Rotation;
+			PC->GetPlayerViewPoint(Location, Rotation);
+			Viewpoints.Add(Location);
+		}
+	}
+
+	if (Viewpoints.IsEmpty()) return;
+
+	for (int32 Index = Workers.Num() - 1; Index >= 0; --Index)
+	{
+		AAutoBot_Character* Worker = Workers[Index].Get();
+		if (!Worker)
+		{
+			IndexByWorker.Remove(Workers[Index]);
+			Workers.RemoveAtSwap(Index, EAllowShrinking::No);
+			Tiers.RemoveAtSwap(Index, EAllowShrinking::No);
+			if (Workers.IsValidIndex(Index))
+			{
+				IndexByWorker.FindChecked(Workers[Index]) = Index;
+			}
+			continue;
+		}
+
+		const FVector Location = Worker->GetActorLocation();
+		float MinDistSq = TNumericLimits<float>::Max();
+		for (const FVector& Viewpoint : Viewpoints)
+		{
+			MinDistSq = FMath::Min(MinDistSq, FVector::DistSquared(Location, Viewpoint));
+		}
+
+		const EWytchSignificanceTier NewTier = ComputeTier(FMath::Sqrt(MinDistSq),
+			Worker->WasRecentlyRendered(VisibilityGraceSeconds), Tiers[Index]);
+		if (NewTier != Tiers[Index])
+		{
+			SetTier(Index, NewTier);
+		}
+	}
+}
+
+void UWytchSignificanceSubsystem::SetTier(int32 Index, EWytchSignificanceTier NewTier)
+{
+	Tiers[Index] = NewTier;
+	if (AAutoBot_Character* Worker = Workers[Index].Get())
+	{
+		Worker->ApplySignificanceTier(NewTier, GetTierSettings(NewTier));
+	}
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WytchSignificanceSubsystem.generated.h"
+
+class AAutoBot_Character;
+
+// ─────────────────────────────────────────────────────────
+// EWytchSignificanceTier — simulation detail level for a worker
+// ─────────────────────────────────────────────────────────
+UENUM(BlueprintType)
+enum class EWytchSignificanceTier : uint8
+{
+	High     UMETA(DisplayName = "High"),
+	Medium   UMETA(DisplayName = "Medium"),
+	Low      UMETA(DisplayName = "Low"),
+	Dormant  UMETA(DisplayName = "Dormant")
+};
+
+// ─────────────────────────────────────────────────────────
+// FWytchSignificanceTierSettings — what one tier costs
+// ─────────────────────────────────────────────────────────
+USTRUCT(BlueprintType)
+struct FWytchSignificanceTierSettings
+{
+	GENERATED_BODY()
+
+	FWytchSignificanceTierSettings() = default;
+
+	FWytchSignificanceTierSettings(float InMaxDistance, float InMovementTickInterval, float InAnimTickInterval,
+		bool bInOnlyTickMontagesWhenNotRendered, float InAITickInterval, bool bInPerceptionEnabled)
+		: MaxDistance(InMaxDistance)
+		, MovementTickInterval(InMovementTickInterval)
+		, AnimTickInterval(InAnimTickInterval)
+		, bOnlyTickMontagesWhenNotRendered(bInOnlyTickMontagesWhenNotRendered)
+		, AITickInterval(InAITickInterval)
+		, bPerceptionEnabled(bInPerceptionEnabled)
+	{
+	}
+
+	/** Workers beyond this distance from every viewpoint drop to the next tier. 0 = unbounded. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float MaxDistance = 0.f;
+
+	/** CharacterMovement tick interval (seconds). 0 = every frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float MovementTickInterval = 0.f;
+
+	/** Skeletal mesh tick interval (seconds). 0 = every frame; URO still skips by screen size on top. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float AnimTickInterval = 0.f;
+
+	/** Only montages tick while the mesh is off screen. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance")
+	bool bOnlyTickMontagesWhenNotRendered = false;
+
+	/** AI controller tick interval (seconds). 0 = every frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float AITickInterval = 0.f;
+
+	/** Senses on the controller's perception component stay enabled. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance")
+	bool bPerceptionEnabled = true;
+};
+
+/**
+ * Significance LOD for AutoBots.
+ *
+ * One timer ranks every registered worker by distance to the nearest local
+ * player viewpoint; workers not rendered recently sit one tier lower. The
+ * tier's settings are pushed to the worker only when its tier changes.
+ *
+ * Promotion is immediate so nothing near the camera runs coarse. Demotion
+ * needs the worker HysteresisFraction past the tier boundary and moves one
+ * tier per update, so a worker on a boundary does not flap and a camera cut
+ * steps distant workers down over a few updates instead of in one frame.
+ * With no local viewpoint (dedicated server) every worker stays High.
+ */
+UCLASS(Config = Game)
+class THEWYTCHING_API UWytchSignificanceSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWytchSignificanceSubsystem* Get(const UWorld* World);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Starts tracking Worker at High. */
+	void RegisterWorker(AAutoBot_Character* Worker);
+	void UnregisterWorker(AAutoBot_Character* Worker);
+
+	const FWytchSignificanceTierSettings& GetTierSettings(EWytchSignificanceTier Tier) const;
+
+	/** Registered workers currently in Tier. */
+	int32 GetNumInTier(EWytchSignificanceTier Tier) const;
+
+	/** Seconds between re-ranking passes. */
+	UPROPERTY(Config)
+	float UpdateInterval = 0.5f;
+
+	/** Fraction past a tier's MaxDistance a worker must be before it is demoted. */
+	UPROPERTY(Config)
+	float HysteresisFraction = 0.1f;
+
+	/** A worker rendered within this many seconds counts as visible. */
+	UPROPERTY(Config)
+	float VisibilityGraceSeconds = 0.5f;
+
+	UPROPERTY(Config)
+	FWytchSignificanceTierSettings HighTier{ 3000.f, 0.f, 0.f, false, 0.f, true };
+
+	UPROPERTY(Config)
+	FWytchSignificanceTierSettings MediumTier{ 8000.f, 0.033f, 0.033f, false, 0.1f, true };
+
+	UPROPERTY(Config)
+	FWytchSignificanceTierSettings LowTier{ 20000.f, 0.1f, 0.1f, true, 0.25f, true };
+
+	UPROPERTY(Config)
+	FWytchSignificanceTierSettings DormantTier{ 0.f, 0.25f, 0.5f, true, 0.5f, false };
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void UpdateSignificance();
+
+	/** Tier a worker at Distance belongs in, ignoring hysteresis. */
+	int32 GetDistanceTier(float Distance) const;
+
+	/** Next tier for a worker in Current — immediate promotion, hysteresis-gated single-step demotion. */
+	EWytchSignificanceTier ComputeTier(float Distance, bool bVisible, EWytchSignificanceTier Current) const;
+
+	void SetTier(int32 Index, EWytchSignificanceTier NewTier);
+
+	// SoA — Workers[i] is in Tiers[i]
+	TArray<TWeakObjectPtr<AAutoBot_Character>> Workers;
+	TArray<EWytchSignificanceTier> Tiers;
+	TMap<TWeakObjectPtr<AAutoBot_Character>, int32> IndexByWorker;
+
+	FTimerHandle UpdateTimerHandle;
+};
@@ -0,0 +1,191 @@
+#include "WytchWorkSessionSubsystem.h"
+
+#include "WytchingStats.h"
+#include "IWytchWorkSite.h"
+#include "Engine/World.h"
+
+UWytchWorkSessionSubsystem* UWytchWorkSessionSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UWytchWorkSessionSubsystem>() : nullptr;
+}
+
+bool UWytchWorkSessionSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UWytchWorkSessionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWytchWorkSessionSubsystem, STATGROUP_Tickables);
+}
+
+void UWytchWorkSessionSubsystem::Deinitialize()
+{
+	Workers.Reset();
+	Sites.Reset();
+	Elapsed.Reset();
+	Durations.Reset();
+	LastTickElapsed.Reset();
+	NextMilestone.Reset();
+	WantsTick.Reset();
+	OnCompletes.Reset();
+	IndexByWorker.Reset();
+
+	Super::Deinitialize();
+}
+
+// ─────────────────────────────────────────────────────────
+// Sessions
+// ─────────────────────────────────────────────────────────
+
+void UWytchWorkSessionSubsystem::BeginSession(AActor* Worker, AActor* Site, float Duration,
+	FOnWytchWorkSessionComplete OnComplete)
+{
+	if (!Worker || !Site || Duration <= 0.f) return;
+
+	EndSession(Worker);
+
+	const float MilestoneStep = GetMilestoneStep(Duration);
+
+	IndexByWorker.Add(Worker, Workers.Num());
+	Workers.Add(Worker);
+	Sites.Add(Site);
+	Elapsed.Add(0.f);
+	Durations.Add(Duration);
+	LastTickElapsed.Add(0.f);
+	NextMilestone.Add(MilestoneStep > 0.f ? MilestoneStep : TNumericLimits<float>::Max());
+	WantsTick.Add(Site->Implements<UWytchWorkSite>() && IWytchWorkSite::Execute_WantsWorkTick(Site));
+	OnCompletes.Add(MoveTemp(OnComplete));
+}
+
+void UWytchWorkSessionSubsystem::EndSession(AActor* Worker)
+{
+	int32 Index = INDEX_NONE;
+	if (IndexByWorker.RemoveAndCopyValue(Worker, Index))
+	{
+		RemoveAt(Index);
+	}
+}
+
+float UWytchWorkSessionSubsystem::GetProgress(const AActor* Worker) const
+{
+	const int32* Index = IndexByWorker.Find(Worker);
+	return Index ? FMath::Clamp(Elapsed[*Index] / Durations[*Index], 0.f, 1.f) : -1.f;
+}
+
+void UWytchWorkSessionSubsystem::RemoveAt(int32 Index)
+{
+	Workers.RemoveAtSwap(Index, EAllowShrinking::No);
+	Sites.RemoveAtSwap(Index, EAllowShrinking::No);
+	Elapsed.RemoveAtSwap(Index, EAllowShrinking::No);
+	Durations.RemoveAtSwap(Index, EAllowShrinking::No);
+	LastTickElapsed.RemoveAtSwap(Index, EAllowShrinking::No);
+	NextMilestone.RemoveAtSwap(Index, EAllowShrinking::No);
+	WantsTick.RemoveAtSwap(Index, EAllowShrinking::No);
+	OnCompletes.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	if (Workers.IsValidIndex(Index))
+	{
+		IndexByWorker.FindChecked(Workers[Index]) = Index;
+	}
+}
+
+float UWytchWorkSessionSubsystem::GetMilestoneStep(float Duration) const
+{
+	// A tiny fraction would fire TickWork every frame — floor it at one step per percent
+	return MilestoneFraction > 0.f ? Duration * FMath::Max(MilestoneFraction, MinMilestoneFraction) : 0.f;
+}
+
+// ─────────────────────────────────────────────────────────
+// Tick — one native pass over every session
+// ─────────────────────────────────────────────────────────
+
+void UWytchWorkSessionSubsystem::Tick(float DeltaTime)
+{
+	WYTCH_SCOPE(STAT_WytchWorkSessions);
+
+	if (Workers.IsEmpty())
+	{
+		return;
+	}
+
+	// Advance progress — plain float math, no dispatch
+	const int32 NumSessions = Workers.Num();
+	for (int32 Index = 0; Index < NumSessions; ++Index)
+	{
+		Elapsed[Index] += DeltaTime;
+	}
+
+	// TickWork only for opted-in sites and milestone crossings; collect completions.
+	// Site and worker callbacks may begin or end sessions, so every call runs after the pass.
+	struct FSiteTick
+	{
+		TWeakObjectPtr<AActor> Site;
+		TWeakObjectPtr<AActor> Worker;
+		float DeltaTime;
+
+		/** The session has already been removed — deliver regardless. */
+		bool bFinal;
+	};
+	TArray<FSiteTick, TInlineAllocator<16>> SiteTicks;
+	TArray<FOnWytchWorkSessionComplete, TInlineAllocator<8>> Completed;
+
+	for (int32 Index = NumSessions - 1; Index >= 0; --Index)
+	{
+		AActor* Worker = Workers[Index].Get();
+		AActor* Site = Sites[Index].Get();
+		if (!Worker)
+		{
+			IndexByWorker.Remove(Workers[Index]);
+			RemoveAt(Index);
+			continue;
+		}
+
+		const bool bDone = Elapsed[Index] >= Durations[Index];
+		const bool bMilestone = Elapsed[Index] >= NextMilestone[Index];
+
+		// Completion always reports the work since the last call, clamped to Duration
+		if (Site && (WantsTick[Index] || bMilestone || bDone) && Site->Implements<UWytchWorkSite>())
+		{
+			const float TickElapsed = FMath::Min(Elapsed[Index], Durations[Index]);
+			const float SiteDeltaTime = TickElapsed - LastTickElapsed[Index];
+			LastTickElapsed[Index] = TickElapsed;
+			if (!bDone || SiteDeltaTime > 0.f)
+			{
+				SiteTicks.Add({ Site, Worker, SiteDeltaTime, bDone });
+			}
+		}
+
+		if (bMilestone && !bDone)
+		{
+			// Jump straight past Elapsed — a long hitch crosses several milestones but fires once
+			const float MilestoneStep = GetMilestoneStep(Durations[Index]);
+			NextMilestone[Index] = MilestoneStep > 0.f
+				? (FMath::FloorToFloat(Elapsed[Index] / MilestoneStep) + 1.f) * MilestoneStep
+				: TNumericLimits<float>::Max();
+		}
+
+		// A vanished site completes the session — the worker moves on rather than waiting out the timer
+		if (bDone || !Site)
+		{
+			Completed.Add(MoveTemp(OnCompletes[Index]));
+			IndexByWorker.Remove(Workers[Index]);
+			RemoveAt(Index);
+		}
+	}
+
+	for (const FSiteTick& SiteTick : SiteTicks)
+	{
+		AActor* Site = SiteTick.Site.Get();
+		AActor* Worker = SiteTick.Worker.Get();
+		if (Site && Worker && (SiteTick.bFinal || IndexByWorker.Contains(SiteTick.Worker)))
+		{
+			IWytchWorkSite::Execute_TickWork(Site, Worker, SiteTick.DeltaTime);
+		}
+	}
+
+	for (FOnWytchWorkSessionComplete& OnComplete : Completed)
+	{
+		OnComplete.ExecuteIfBound();
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WytchWorkSessionSubsystem.generated.h"
+
+DECLARE_DELEGATE(FOnWytchWorkSessionComplete);
+
+/**
+ * Central work-session manager.
+ *
+ * Every active (worker, site, progress, duration) session lives in parallel
+ * arrays and is advanced natively in one loop per frame. IWytchWorkSite::
+ * TickWork is only dispatched to sites that opt in (WantsWorkTick) or when
+ * a session crosses a MilestoneFraction progress step, so a site with no
+ * per-frame work costs no Blueprint calls between BeginWork and EndWork.
+ *
+ * When a session reaches its duration the site gets a last TickWork for the
+ * remainder up to Duration, the session is removed and its completion
+ * delegate fires — the worker then calls EndWork as before.
+ */
+UCLASS(Config = Game)
+class THEWYTCHING_API UWytchWorkSessionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UWytchWorkSessionSubsystem* Get(const UWorld* World);
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Starts Worker's session on Site. Duration must be > 0 — instant work
+	 * completes in the caller. Replaces any session Worker already has.
+	 */
+	void BeginSession(AActor* Worker, AActor* Site, float Duration, FOnWytchWorkSessionComplete OnComplete);
+
+	/** Drops Worker's session without completing it. */
+	void EndSession(AActor* Worker);
+
+	/** 0..1, or -1 if Worker has no session. */
+	float GetProgress(const AActor* Worker) const;
+
+	int32 Num() const { return Workers.Num(); }
+
+	/** Progress step at which non-ticking sites still get a TickWork. 0 = never; floored at MinMilestoneFraction. */
+	UPROPERTY(Config)
+	float MilestoneFraction = 0.25f;
+
+	static constexpr float MinMilestoneFraction = 0.01f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void RemoveAt(int32 Index);
+
+	/** Elapsed between milestones for a session of Duration. 0 = no milestones. */
+	float GetMilestoneStep(float Duration) const;
+
+	// SoA — index i across every array is one session
+	TArray<TWeakObjectPtr<AActor>> Workers;
+	TArray<TWeakObjectPtr<AActor>> Sites;
+	TArray<float> Elapsed;
+	TArray<float> Durations;
+
+	/** Elapsed at the last TickWork — the next call's DeltaTime is measured from here. */
+	TArray<float> LastTickElapsed;
+
+	/** Elapsed at which the next milestone TickWork fires. */
+	TArray<float> NextMilestone;
+
+	TArray<bool> WantsTick;
+	TArray<FOnWytchWorkSessionComplete> OnCompletes;
+
+	TMap<TWeakObjectPtr<AActor>, int32> IndexByWorker;
+};
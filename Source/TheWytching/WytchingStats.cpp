@@ -0,0 +1,141 @@
+#include "WytchingStats.h"
+
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Misc/ScopeLock.h"
+
+UE_TRACE_CHANNEL_DEFINE(WytchingChannel);
+
+DEFINE_STAT(STAT_WytchBrainSnap);
+DEFINE_STAT(STAT_WytchBrainCapture);
+DEFINE_STAT(STAT_WytchBrainReadback);
+DEFINE_STAT(STAT_WytchBrainEncode);
+DEFINE_STAT(STAT_WytchBrainBase64);
+DEFINE_STAT(STAT_WytchBrainContext);
+DEFINE_STAT(STAT_WytchBrainSend);
+DEFINE_STAT(STAT_WytchBrainParse);
+DEFINE_STAT(STAT_WytchBrainAction);
+
+DEFINE_STAT(STAT_WytchForemanScan);
+DEFINE_STAT(STAT_WytchForemanSnapshot);
+DEFINE_STAT(STAT_WytchForemanJobSync);
+DEFINE_STAT(STAT_WytchForemanPreassign);
+DEFINE_STAT(STAT_WytchForemanMassDispatch);
+DEFINE_STAT(STAT_WytchForemanPlan);
+DEFINE_STAT(STAT_WytchForemanAssign);
+DEFINE_STAT(STAT_WytchForemanMove);
+
+DEFINE_STAT(STAT_WytchEvalWorkAvailability);
+DEFINE_STAT(STAT_WytchCondHasIdleWorkers);
+DEFINE_STAT(STAT_WytchCondHasAvailableWork);
+DEFINE_STAT(STAT_WytchTaskPlanJob);
+DEFINE_STAT(STAT_WytchTaskMonitor);
+
+DEFINE_STAT(STAT_WytchPowerDrain);
+DEFINE_STAT(STAT_WytchWorkSessions);
+DEFINE_STAT(STAT_WytchSignificance);
+DEFINE_STAT(STAT_WytchMassRepresentation);
+DEFINE_STAT(STAT_WytchMoveWatchdog);
+
+// ─────────────────────────────────────────────────────────
+// FWytchLLMTrace
+// ─────────────────────────────────────────────────────────
+
+void FWytchLLMTrace::BeginRoundTrip(const TCHAR* InSource)
+{
+	// Game-thread only — HTTP completions are dispatched there too
+	static uint32 NextId = 0;
+
+	EndRoundTrip();
+
+	Source = InSource;
+	Id = ++NextId;
+	RoundTripRegion = FString::Printf(TEXT("%s LLM #%u"), *Source, Id);
+	TRACE_BEGIN_REGION(*RoundTripRegion);
+}
+
+void FWytchLLMTrace::BeginNetwork()
+{
+	if (RoundTripRegion.IsEmpty() || !NetworkRegion.IsEmpty()) return;
+
+	NetworkRegion = FString::Printf(TEXT("%s LLM network #%u"), *Source, Id);
+	TRACE_BEGIN_REGION(*NetworkRegion);
+}
+
+void FWytchLLMTrace::EndNetwork()
+{
+	if (NetworkRegion.IsEmpty()) return;
+
+	TRACE_END_REGION(*NetworkRegion);
+	NetworkRegion.Reset();
+}
+
+void FWytchLLMTrace::EndRoundTrip()
+{
+	EndNetwork();
+	if (RoundTripRegion.IsEmpty()) return;
+
+	TRACE_END_REGION(*RoundTripRegion);
+	RoundTripRegion.Reset();
+}
+
+// ─────────────────────────────────────────────────────────
+// FWytchCpuCostCapture
+// ─────────────────────────────────────────────────────────
+
+std::atomic<bool> FWytchCpuCostCapture::bCapturing{ false };
+
+namespace WytchCpuCost
+{
+	struct FCounter
+	{
+		uint64 Calls = 0;
+		uint64 Cycles = 0;
+	};
+
+	// Keyed by the scope's TEXT literal — the same stat in two files may be two keys, merged on read
+	static TMap<const TCHAR*, FCounter> Counters;
+	static FCriticalSection Lock;
+}
+
+void FWytchCpuCostCapture::Start()
+{
+	FScopeLock ScopeLock(&WytchCpuCost::Lock);
+	WytchCpuCost::Counters.Reset();
+	bCapturing.store(true, std::memory_order_relaxed);
+}
+
+void FWytchCpuCostCapture::Stop()
+{
+	bCapturing.store(false, std::memory_order_relaxed);
+}
+
+void FWytchCpuCostCapture::Add(const TCHAR* Name, uint64 Cycles)
+{
+	FScopeLock ScopeLock(&WytchCpuCost::Lock);
+	WytchCpuCost::FCounter& Counter = WytchCpuCost::Counters.FindOrAdd(Name);
+	++Counter.Calls;
+	Counter.Cycles += Cycles;
+}
+
+TArray<FWytchCpuCostCapture::FEntry> FWytchCpuCostCapture::GetEntries()
+{
+	TMap<FString, FEntry> Merged;
+	{
+		FScopeLock ScopeLock(&WytchCpuCost::Lock);
+		for (const TPair<const TCHAR*, WytchCpuCost::FCounter>& Pair : WytchCpuCost::Counters)
+		{
+			FString Name = Pair.Key;
+			Name.RemoveFromStart(TEXT("STAT_Wytch"));
+
+			FEntry& Entry = Merged.FindOrAdd(Name);
+			Entry.Name = Name;
+			Entry.Calls += Pair.Value.Calls;
+			Entry.Cycles += Pair.Value.Cycles;
+		}
+	}
+
+	TArray<FEntry> Entries;
+	Merged.GenerateValueArray(Entries);
+	Entries.Sort([](const FEntry& A, const FEntry& B) { return A.Cycles > B.Cycles; });
+	return Entries;
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include <atomic>
+
+// ─────────────────────────────────────────────────────────
+// Wytching stat group + trace channel
+//   `stat Wytching` shows every scope below; in Insights enable the
+//   Wytching channel (-trace=cpu,wytching) for the CPU scopes and
+//   the per-LLM-round-trip timing regions.
+// ─────────────────────────────────────────────────────────
+
+DECLARE_STATS_GROUP(TEXT("Wytching"), STATGROUP_Wytching, STATCAT_Advanced);
+
+UE_TRACE_CHANNEL_EXTERN(WytchingChannel, THEWYTCHING_API);
+
+// ── Brain / drone vision pipeline ──
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain Snap"), STAT_WytchBrainSnap, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain Capture"), STAT_WytchBrainCapture, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain Readback"), STAT_WytchBrainReadback, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain PNG Encode"), STAT_WytchBrainEncode, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain Base64"), STAT_WytchBrainBase64, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain Context"), STAT_WytchBrainContext, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain HTTP Send"), STAT_WytchBrainSend, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain JSON Parse"), STAT_WytchBrainParse, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Brain Action"), STAT_WytchBrainAction, STATGROUP_Wytching, THEWYTCHING_API);
+
+// ── Foreman dispatch ──
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Foreman Scan"), STAT_WytchForemanScan, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Foreman Snapshot"), STAT_WytchForemanSnapshot, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Foreman Job Sync"), STAT_WytchForemanJobSync, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Foreman Preassign"), STAT_WytchForemanPreassign, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Foreman Mass Dispatch"), STAT_WytchForemanMassDispatch, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Foreman Plan Batch"), STAT_WytchForemanPlan, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Foreman Assign"), STAT_WytchForemanAssign, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Foreman Move Order"), STAT_WytchForemanMove, STATGROUP_Wytching, THEWYTCHING_API);
+
+// ── Foreman StateTree nodes (whole node, nested scopes above count inside) ──
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ST WorkAvailability"), STAT_WytchEvalWorkAvailability, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ST HasIdleWorkers"), STAT_WytchCondHasIdleWorkers, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ST HasAvailableWork"), STAT_WytchCondHasAvailableWork, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ST PlanJob"), STAT_WytchTaskPlanJob, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ST Monitor"), STAT_WytchTaskMonitor, STATGROUP_Wytching, THEWYTCHING_API);
+
+// ── Worker-side batches ──
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Power Drain"), STAT_WytchPowerDrain, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Work Sessions"), STAT_WytchWorkSessions, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Significance Update"), STAT_WytchSignificance, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Mass Representation"), STAT_WytchMassRepresentation, STATGROUP_Wytching, THEWYTCHING_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Move Watchdog"), STAT_WytchMoveWatchdog, STATGROUP_Wytching, THEWYTCHING_API);
+
+// ─────────────────────────────────────────────────────────
+// FWytchCpuCostCapture — per-scope call counts and cycles
+//   Off by default. While capturing, every WYTCH_SCOPE adds its
+//   cost under the stat's name, so headless runs (the dispatch
+//   stress commandlet) can report per-task CPU cost without a
+//   stats capture. Costs one relaxed load per scope when off.
+// ─────────────────────────────────────────────────────────
+class THEWYTCHING_API FWytchCpuCostCapture
+{
+public:
+	struct FEntry
+	{
+		FString Name;
+		uint64 Calls = 0;
+		uint64 Cycles = 0;
+	};
+
+	/** Clears previous results and starts capturing. */
+	static void Start();
+	static void Stop();
+
+	static bool IsCapturing() { return bCapturing.load(std::memory_order_relaxed); }
+
+	static void Add(const TCHAR* Name, uint64 Cycles);
+
+	/** Captured scopes, most expensive first. */
+	static TArray<FEntry> GetEntries();
+
+private:
+	static std::atomic<bool> bCapturing;
+};
+
+class FWytchCpuCostScope
+{
+public:
+	explicit FWytchCpuCostScope(const TCHAR* InName)
+		: Name(InName)
+		, StartCycles(FWytchCpuCostCapture::IsCapturing() ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	~FWytchCpuCostScope()
+	{
+		if (StartCycles != 0)
+		{
+			FWytchCpuCostCapture::Add(Name, FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+
+private:
+	const TCHAR* Name;
+	uint64 StartCycles;
+};
+
+/** Stat counter + Insights CPU scope on the Wytching channel + CPU cost capture for the rest of the block. */
+#define WYTCH_SCOPE(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Stat, WytchingChannel); \
+	FWytchCpuCostScope PREPROCESSOR_JOIN(WytchCpuCost_, __LINE__)(TEXT(#Stat))
+
+// ─────────────────────────────────────────────────────────
+// FWytchLLMTrace — Insights timing regions for one LLM round trip
+//   "<Source> LLM #n" spans snap → response handled; "<Source>
+//   LLM network #n" spans request sent → response received. Both
+//   are numbered so overlapping requests stay distinct. End calls
+//   are safe when nothing is open.
+// ─────────────────────────────────────────────────────────
+class THEWYTCHING_API FWytchLLMTrace
+{
+public:
+	void BeginRoundTrip(const TCHAR* Source);
+	void BeginNetwork();
+	void EndNetwork();
+
+	/** Also ends the network region if still open. */
+	void EndRoundTrip();
+
+private:
+	FString RoundTripRegion;
+	FString NetworkRegion;
+	FString Source;
+	uint32 Id = 0;
+};